@@ -0,0 +1,220 @@
+// Header guard
+#ifndef COMPACT_EDGE_LIST_H
+#define COMPACT_EDGE_LIST_H
+
+
+// Header files
+using namespace std;
+
+
+// Constants
+
+// Compact edge list empty node
+#define COMPACT_EDGE_LIST_EMPTY_NODE UINT32_MAX
+
+// Compact edge list bytes per edge
+#define COMPACT_EDGE_LIST_BYTES_PER_EDGE (sizeof(uint32_t) * 3 + sizeof(uint32_t) * 4)
+
+
+// Classes
+
+// Compact edge structure
+struct CompactEdge {
+
+	// Edge index
+	uint32_t edgeIndex;
+	
+	// Nodes
+	uint32_t nodes[2];
+};
+
+// Compact edge list class
+class CompactEdgeList final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline CompactEdgeList();
+		
+		// Reserve
+		inline bool reserve(const size_t capacity);
+		
+		// Get capacity
+		inline size_t getCapacity() const;
+		
+		// Clear
+		inline void clear();
+		
+		// Add
+		inline void add(const uint32_t edgeIndex, const uint32_t uNode, const uint32_t vNode);
+		
+		// Trim
+		ITCM_CODE inline void trim(const int partition);
+		
+		// Get number of edges
+		inline size_t getNumberOfEdges() const;
+		
+		// Get edges
+		inline const CompactEdge *getEdges() const;
+	
+	// Private
+	private:
+	
+		// Edges
+		unique_ptr<CompactEdge[]> edges;
+		
+		// Nodes table
+		unique_ptr<uint32_t[]> nodesTable;
+		
+		// Capacity
+		size_t capacity;
+		
+		// Number of edges
+		size_t numberOfEdges;
+};
+
+
+// Supporting function implementation
+
+// Constructor
+CompactEdgeList::CompactEdgeList() :
+
+	// Set capacity to zero
+	capacity(0),
+	
+	// Set number of edges to zero
+	numberOfEdges(0)
+{
+}
+
+// Reserve
+bool CompactEdgeList::reserve(const size_t capacity) {
+
+	// Check if edges can already hold the capacity
+	if(capacity <= this->capacity) {
+	
+		// Return true
+		return true;
+	}
+	
+	// Free edges and nodes table
+	edges.reset();
+	nodesTable.reset();
+	this->capacity = 0;
+	numberOfEdges = 0;
+	
+	// Check if creating edges and nodes table failed
+	edges = unique_ptr<CompactEdge[]>(new(nothrow) CompactEdge[capacity]);
+	nodesTable = unique_ptr<uint32_t[]>(new(nothrow) uint32_t[bit_ceil(capacity * 2)]);
+	if(!edges || !nodesTable) {
+	
+		// Free edges and nodes table
+		edges.reset();
+		nodesTable.reset();
+		
+		// Return false
+		return false;
+	}
+	
+	// Set capacity
+	this->capacity = capacity;
+	
+	// Return true
+	return true;
+}
+
+// Get capacity
+size_t CompactEdgeList::getCapacity() const {
+
+	// Return capacity
+	return capacity;
+}
+
+// Clear
+void CompactEdgeList::clear() {
+
+	// Set number of edges to zero
+	numberOfEdges = 0;
+}
+
+// Add
+void CompactEdgeList::add(const uint32_t edgeIndex, const uint32_t uNode, const uint32_t vNode) {
+
+	// Add edge to the edges
+	edges[numberOfEdges++] = {edgeIndex, {uNode, vNode}};
+}
+
+// Trim
+void CompactEdgeList::trim(const int partition) {
+
+	// Clear the part of the nodes table that can hold twice the number of edges
+	const size_t nodesTableMask = bit_ceil(max(numberOfEdges * 2, static_cast<size_t>(1))) - 1;
+	memset(nodesTable.get(), UINT8_MAX, sizeof(nodesTable[0]) * (nodesTableMask + 1));
+	
+	// Go through all edges
+	for(size_t i = 0; i < numberOfEdges; ++i) {
+	
+		// Go through all of the edge's node's entries in the nodes table
+		const uint32_t node = edges[i].nodes[partition];
+		for(size_t j = node & nodesTableMask;; j = (j + 1) & nodesTableMask) {
+		
+			// Check if entry is empty
+			if(nodesTable[j] == COMPACT_EDGE_LIST_EMPTY_NODE) {
+			
+				// Add node to the entry
+				nodesTable[j] = node;
+				
+				// Break
+				break;
+			}
+			
+			// Check if entry is the node
+			if(nodesTable[j] == node) {
+			
+				// Break
+				break;
+			}
+		}
+	}
+	
+	// Go through all edges
+	size_t newNumberOfEdges = 0;
+	for(size_t i = 0; i < numberOfEdges; ++i) {
+	
+		// Go through all of the edge's node's pair's entries in the nodes table
+		const uint32_t nodePair = edges[i].nodes[partition] ^ 1;
+		for(size_t j = nodePair & nodesTableMask; nodesTable[j] != COMPACT_EDGE_LIST_EMPTY_NODE; j = (j + 1) & nodesTableMask) {
+		
+			// Check if entry is the node's pair
+			if(nodesTable[j] == nodePair) {
+			
+				// Keep edge
+				edges[newNumberOfEdges++] = edges[i];
+				
+				// Break
+				break;
+			}
+		}
+	}
+	
+	// Set number of edges
+	numberOfEdges = newNumberOfEdges;
+}
+
+// Get number of edges
+size_t CompactEdgeList::getNumberOfEdges() const {
+
+	// Return number of edges
+	return numberOfEdges;
+}
+
+// Get edges
+const CompactEdge *CompactEdgeList::getEdges() const {
+
+	// Return edges
+	return edges.get();
+}
+
+
+#endif
@@ -7,52 +7,288 @@
 using namespace std;
 
 
+// Constants
+
+// Cuckatoo no node connection
+#define CUCKATOO_NO_NODE_CONNECTION UINT32_MAX
+
+// Cuckatoo node connections bytes per edge
+#define CUCKATOO_NODE_CONNECTIONS_BYTES_PER_EDGE (sizeof(uint32_t) * (2 + 2 + 1 + 1))
+
+
 // Structures
 
-// Cuckatoo node connection structure
-struct CuckatooNodeConnection {
+// Cuckatoo node connections structure
+struct CuckatooNodeConnections {
 
-	// Previous node connection link
-	const CuckatooNodeConnection *previousNodeConnection;
+	// Memory
+	unique_ptr<uint32_t[]> memory;
+	
+	// Previous node connections
+	uint32_t *previousNodeConnections;
+	
+	// Nodes
+	uint32_t *nodes;
+	
+	// Edges index
+	uint32_t *edgesIndex;
+	
+	// Edges component
+	uint32_t *edgesComponent;
+};
+
+// Cuckatoo search frame structure
+struct CuckatooSearchFrame {
+
+	// Node connection
+	uint32_t nodeConnection;
+	
+	// Visited node pair index
+	uint32_t visitedNodePairIndex;
+};
+
+// Cuckatoo components structure
+struct CuckatooComponents {
+
+	// Memory
+	unique_ptr<uint32_t[]> memory;
+	
+	// Edges component
+	uint32_t *edgesComponent;
+	
+	// Components number of cycles
+	uint32_t *componentsNumberOfCycles;
 	
-	// Node
-	uint32_t node;
+	// Components edges
+	uint32_t *componentsEdges;
 	
-	// Edge index
-	uint32_t edgeIndex;
+	// Components start
+	uint32_t *componentsStart;
 };
 
 
 // Function prototypes
 
+// Create cuckatoo node connections
+static inline bool createCuckatooNodeConnections(CuckatooNodeConnections &nodeConnections, const size_t numberOfEdges);
+
+// Create cuckatoo components
+static inline bool createCuckatooComponents(CuckatooComponents &components, const size_t numberOfEdges);
+
+// Get cuckatoo components edges
+ITCM_CODE static inline uint32_t getCuckatooComponentsEdges(const CompactEdge *edges, CuckatooComponents &components, const uint32_t numberOfEdges, HashTable<uint32_t> &uNodePairsEdge, HashTable<uint32_t> &vNodePairsEdge);
+
 // Get cuckatoo solution
-ITCM_CODE static inline bool getCuckatooSolution(const uint32_t edgeIndex, const uint32_t uNode, const uint32_t vNode, CuckatooNodeConnection *nodeConnections, HashTable<CuckatooNodeConnection, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &newestUNodesConnection, HashTable<CuckatooNodeConnection, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &newestVNodesConnection, uint32_t solution[SOLUTION_SIZE]);
+ITCM_CODE static inline bool getCuckatooSolution(const uint32_t edgeIndex, const uint32_t uNode, const uint32_t vNode, CuckatooNodeConnections &nodeConnections, const uint32_t numberOfEdges, HashTable<uint32_t> &newestUNodesConnection, HashTable<uint32_t> &newestVNodesConnection, HashTable<uint32_t> &visitedUNodePairs, HashTable<uint32_t> &visitedVNodePairs, uint32_t solution[SOLUTION_SIZE]);
 
-// Search u node connections for cuckatoo solution
-ITCM_CODE static inline bool searchUNodeConnectionsForCuckatooSolution(const int cycleSize, const uint32_t node, const uint32_t *edgeIndex, const uint32_t rootNode, const HashTable<CuckatooNodeConnection, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &newestUNodesConnection, const HashTable<CuckatooNodeConnection, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &newestVNodesConnection, HashTable<uint32_t, SOLUTION_SIZE / 2> &visitedUNodePairs, HashTable<uint32_t, SOLUTION_SIZE / 2> &visitedVNodePairs);
+// Get cuckatoo component
+ITCM_CODE static inline uint32_t getCuckatooComponent(uint32_t *edgesComponent, uint32_t edge);
 
-// Search v node connections for cuckatoo solution
-ITCM_CODE static inline bool searchVNodeConnectionsForCuckatooSolution(const int cycleSize, const uint32_t node, const uint32_t *edgeIndex, const uint32_t rootNode, const HashTable<CuckatooNodeConnection, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &newestUNodesConnection, const HashTable<CuckatooNodeConnection, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &newestVNodesConnection, HashTable<uint32_t, SOLUTION_SIZE / 2> &visitedUNodePairs, HashTable<uint32_t, SOLUTION_SIZE / 2> &visitedVNodePairs);
+// Search node connections for cuckatoo solution
+ITCM_CODE static inline bool searchNodeConnectionsForCuckatooSolution(const int cycleSize, const int partition, const uint32_t node, const uint32_t edgeIndex, const uint32_t rootNode, const CuckatooNodeConnections &nodeConnections, const HashTable<uint32_t> &newestUNodesConnection, const HashTable<uint32_t> &newestVNodesConnection, HashTable<uint32_t> &visitedUNodePairs, HashTable<uint32_t> &visitedVNodePairs);
+
+// Verify cuckatoo solution
+static inline bool verifyCuckatooSolution(const uint8_t jobHeader[HEADER_SIZE], const uint64_t jobNonce, const uint32_t solution[SOLUTION_SIZE]);
 
 
 // Supporting function implementation
 
+// Create cuckatoo node connections
+bool createCuckatooNodeConnections(CuckatooNodeConnections &nodeConnections, const size_t numberOfEdges) {
+
+	// Check if creating memory failed
+	nodeConnections.memory = unique_ptr<uint32_t[]>(new(nothrow) uint32_t[numberOfEdges * (CUCKATOO_NODE_CONNECTIONS_BYTES_PER_EDGE / sizeof(uint32_t))]);
+	if(!nodeConnections.memory) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Set previous node connections, nodes, edges index, and edges component to their parts of the memory
+	nodeConnections.previousNodeConnections = nodeConnections.memory.get();
+	nodeConnections.nodes = &nodeConnections.previousNodeConnections[numberOfEdges * 2];
+	nodeConnections.edgesIndex = &nodeConnections.nodes[numberOfEdges * 2];
+	nodeConnections.edgesComponent = &nodeConnections.edgesIndex[numberOfEdges];
+	
+	// Return true
+	return true;
+}
+
+// Create cuckatoo components
+bool createCuckatooComponents(CuckatooComponents &components, const size_t numberOfEdges) {
+
+	// Check if creating memory failed
+	components.memory = unique_ptr<uint32_t[]>(new(nothrow) uint32_t[numberOfEdges * 3 + numberOfEdges / SOLUTION_SIZE + 1]);
+	if(!components.memory) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Set edges component, components number of cycles, components edges, and components start to their parts of the memory
+	components.edgesComponent = components.memory.get();
+	components.componentsNumberOfCycles = &components.edgesComponent[numberOfEdges];
+	components.componentsEdges = &components.componentsNumberOfCycles[numberOfEdges];
+	components.componentsStart = &components.componentsEdges[numberOfEdges];
+	
+	// Return true
+	return true;
+}
+
+// Get cuckatoo components edges
+uint32_t getCuckatooComponentsEdges(const CompactEdge *edges, CuckatooComponents &components, const uint32_t numberOfEdges, HashTable<uint32_t> &uNodePairsEdge, HashTable<uint32_t> &vNodePairsEdge) {
+
+	// Clear node pairs edge
+	uNodePairsEdge.clear();
+	vNodePairsEdge.clear();
+	
+	// Go through all edges
+	for(uint32_t i = 0; i < numberOfEdges; ++i) {
+	
+		// Set edge's component to only contain the edge
+		components.edgesComponent[i] = i;
+		components.componentsNumberOfCycles[i] = 0;
+		
+		// Check if the u node's node pair already has an edge
+		uint32_t uNodePairEdge;
+		if(uNodePairsEdge.replace(edges[i].nodes[0] >> 1, i, uNodePairEdge)) {
+		
+			// Add edge to the u node's node pair's component
+			components.edgesComponent[i] = getCuckatooComponent(components.edgesComponent, uNodePairEdge);
+		}
+		
+		// Check if the v node's node pair already has an edge
+		uint32_t vNodePairEdge;
+		if(vNodePairsEdge.replace(edges[i].nodes[1] >> 1, i, vNodePairEdge)) {
+		
+			// Check if the v node's node pair is in the same component as the edge
+			const uint32_t edgeComponent = components.edgesComponent[i];
+			const uint32_t vNodePairComponent = getCuckatooComponent(components.edgesComponent, vNodePairEdge);
+			if(vNodePairComponent == edgeComponent) {
+			
+				// Increment component's number of cycles
+				++components.componentsNumberOfCycles[edgeComponent];
+			}
+			
+			// Otherwise
+			else {
+			
+				// Merge the v node's node pair's component into the edge's component
+				components.edgesComponent[vNodePairComponent] = edgeComponent;
+				components.componentsNumberOfCycles[edgeComponent] += components.componentsNumberOfCycles[vNodePairComponent];
+			}
+		}
+	}
+	
+	// Go through all edges
+	uint32_t numberOfComponentsEdges = 0;
+	for(uint32_t i = 0; i < numberOfEdges; ++i) {
+	
+		// Point edge directly at its component
+		components.edgesComponent[i] = getCuckatooComponent(components.edgesComponent, i);
+		
+		// Check if edge's component has a cycle
+		if(components.componentsNumberOfCycles[components.edgesComponent[i]]) {
+		
+			// Add edge to the components edges
+			components.componentsEdges[numberOfComponentsEdges++] = i;
+		}
+	}
+	
+	// Sort components edges by component while keeping the edges in each component in order
+	sort(components.componentsEdges, components.componentsEdges + numberOfComponentsEdges, [&components](const uint32_t firstEdge, const uint32_t secondEdge) {
+	
+		// Return if the first edge is in a lower component or is earlier in the same component
+		return (components.edgesComponent[firstEdge] != components.edgesComponent[secondEdge]) ? components.edgesComponent[firstEdge] < components.edgesComponent[secondEdge] : firstEdge < secondEdge;
+	});
+	
+	// Go through all components
+	uint32_t numberOfComponents = 0;
+	components.componentsStart[0] = 0;
+	for(uint32_t i = 0, j; i < numberOfComponentsEdges; i = j) {
+	
+		// Go to the component's end
+		for(j = i + 1; j < numberOfComponentsEdges && components.edgesComponent[components.componentsEdges[j]] == components.edgesComponent[components.componentsEdges[i]]; ++j);
+		
+		// Check if component has enough edges to contain a solution
+		if(j - i >= SOLUTION_SIZE) {
+		
+			// Move component's edges after the previous component's edges
+			memmove(&components.componentsEdges[components.componentsStart[numberOfComponents]], &components.componentsEdges[i], sizeof(components.componentsEdges[0]) * (j - i));
+			
+			// Set next component's start
+			components.componentsStart[numberOfComponents + 1] = components.componentsStart[numberOfComponents] + (j - i);
+			++numberOfComponents;
+		}
+	}
+	
+	// Return number of components
+	return numberOfComponents;
+}
+
 // Get cuckatoo solution
-bool getCuckatooSolution(const uint32_t edgeIndex, const uint32_t uNode, const uint32_t vNode, CuckatooNodeConnection *nodeConnections, HashTable<CuckatooNodeConnection, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &newestUNodesConnection, HashTable<CuckatooNodeConnection, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &newestVNodesConnection, uint32_t solution[SOLUTION_SIZE]) {
+bool getCuckatooSolution(const uint32_t edgeIndex, const uint32_t uNode, const uint32_t vNode, CuckatooNodeConnections &nodeConnections, const uint32_t numberOfEdges, HashTable<uint32_t> &newestUNodesConnection, HashTable<uint32_t> &newestVNodesConnection, HashTable<uint32_t> &visitedUNodePairs, HashTable<uint32_t> &visitedVNodePairs, uint32_t solution[SOLUTION_SIZE]) {
 
+	// Get a node connection already at each node's node pair
+	const uint32_t *uNodePairConnection = newestUNodesConnection.contains(uNode) ? newestUNodesConnection.get(uNode) : newestUNodesConnection.get(uNode ^ 1);
+	const uint32_t *vNodePairConnection = newestVNodesConnection.contains(vNode) ? newestVNodesConnection.get(vNode) : newestVNodesConnection.get(vNode ^ 1);
+	
+	// Set edge's component to only contain the edge
+	nodeConnections.edgesComponent[numberOfEdges] = numberOfEdges;
+	
+	// Check if the u node's node pair is already connected
+	bool closesCycle = false;
+	if(uNodePairConnection) {
+	
+		// Add edge to the u node's node pair's component
+		const uint32_t uNodePairComponent = getCuckatooComponent(nodeConnections.edgesComponent, *uNodePairConnection / 2);
+		nodeConnections.edgesComponent[numberOfEdges] = uNodePairComponent;
+		
+		// Check if the v node's node pair is already connected
+		if(vNodePairConnection) {
+		
+			// Check if the v node's node pair is in the same component as the u node's node pair
+			const uint32_t vNodePairComponent = getCuckatooComponent(nodeConnections.edgesComponent, *vNodePairConnection / 2);
+			if(vNodePairComponent == uNodePairComponent) {
+			
+				// Set closes cycle to true
+				closesCycle = true;
+			}
+			
+			// Otherwise
+			else {
+			
+				// Merge the v node's node pair's component into the u node's node pair's component
+				nodeConnections.edgesComponent[vNodePairComponent] = uNodePairComponent;
+			}
+		}
+	}
+	
+	// Otherwise check if the v node's node pair is already connected
+	else if(vNodePairConnection) {
+	
+		// Add edge to the v node's node pair's component
+		nodeConnections.edgesComponent[numberOfEdges] = getCuckatooComponent(nodeConnections.edgesComponent, *vNodePairConnection / 2);
+	}
+	
 	// Replace newest node connections for the nodes on both partitions and add node connections to list
-	nodeConnections[0] = {newestUNodesConnection.replace(uNode, &nodeConnections[0]), uNode, edgeIndex};
-	nodeConnections[1] = {newestVNodesConnection.replace(vNode, &nodeConnections[1]), vNode, edgeIndex};
+	nodeConnections.previousNodeConnections[numberOfEdges * 2] = CUCKATOO_NO_NODE_CONNECTION;
+	nodeConnections.previousNodeConnections[numberOfEdges * 2 + 1] = CUCKATOO_NO_NODE_CONNECTION;
+	newestUNodesConnection.replace(uNode, numberOfEdges * 2, nodeConnections.previousNodeConnections[numberOfEdges * 2]);
+	newestVNodesConnection.replace(vNode, numberOfEdges * 2 + 1, nodeConnections.previousNodeConnections[numberOfEdges * 2 + 1]);
+	nodeConnections.nodes[numberOfEdges * 2] = uNode;
+	nodeConnections.nodes[numberOfEdges * 2 + 1] = vNode;
+	nodeConnections.edgesIndex[numberOfEdges] = edgeIndex;
 	
-	// Check if both nodes have a pair
-	if(newestUNodesConnection.contains(uNode ^ 1) && newestVNodesConnection.contains(vNode ^ 1)) {
+	// Check if edge closes a cycle and both nodes have a pair
+	if(closesCycle && newestUNodesConnection.contains(uNode ^ 1) && newestVNodesConnection.contains(vNode ^ 1)) {
 	
-		// Create visited node pairs
-		HashTable<uint32_t, SOLUTION_SIZE / 2> visitedUNodePairs;
-		HashTable<uint32_t, SOLUTION_SIZE / 2> visitedVNodePairs;
+		// Clear visited node pairs
+		visitedUNodePairs.clear();
+		visitedVNodePairs.clear();
 		
 		// Go through all nodes in the cycle
-		const uint32_t *index = &edgeIndex;
+		uint32_t index = edgeIndex;
 		uint32_t node = uNode;
 		for(int cycleSize = 1;; cycleSize += 2) {
 		
@@ -60,17 +296,17 @@ bool getCuckatooSolution(const uint32_t edgeIndex, const uint32_t uNode, const u
 			visitedUNodePairs.setUnique(node >> 1, index);
 			
 			// Check if node's pair has more than one connection
-			const CuckatooNodeConnection *nodeConnection = newestUNodesConnection.get(node ^ 1);
-			if(nodeConnection->previousNodeConnection) {
+			uint32_t nodeConnection = *newestUNodesConnection.get(node ^ 1);
+			if(nodeConnections.previousNodeConnections[nodeConnection] != CUCKATOO_NO_NODE_CONNECTION) {
 			
 				// Go through all of the node's pair's connections
-				for(; nodeConnection; nodeConnection = nodeConnection->previousNodeConnection) {
+				for(; nodeConnection != CUCKATOO_NO_NODE_CONNECTION; nodeConnection = nodeConnections.previousNodeConnections[nodeConnection]) {
 				
 					// Check if the connected node's pair wasn't already visited
-					if(!visitedVNodePairs.contains((nodeConnection + 1)->node >> 1)) {
+					if(!visitedVNodePairs.contains(nodeConnections.nodes[nodeConnection + 1] >> 1)) {
 					
 						// Check if cycle is complete
-						if(((nodeConnection + 1)->node ^ 1) == vNode) {
+						if((nodeConnections.nodes[nodeConnection + 1] ^ 1) == vNode) {
 						
 							// Check if cycle is a solution
 							if(cycleSize == SOLUTION_SIZE - 1) {
@@ -78,7 +314,7 @@ bool getCuckatooSolution(const uint32_t edgeIndex, const uint32_t uNode, const u
 								// Get solution from visited nodes
 								visitedUNodePairs.getValues(solution);
 								visitedVNodePairs.getValues(&solution[SOLUTION_SIZE / 2]);
-								solution[SOLUTION_SIZE - 1] = (nodeConnection + 1)->edgeIndex;
+								solution[SOLUTION_SIZE - 1] = nodeConnections.edgesIndex[nodeConnection / 2];
 								
 								// Sort solution in ascending order
 								sort(solution, solution + SOLUTION_SIZE);
@@ -92,10 +328,10 @@ bool getCuckatooSolution(const uint32_t edgeIndex, const uint32_t uNode, const u
 						else if(cycleSize != SOLUTION_SIZE - 1) {
 						
 							// Check if the connected node has a pair
-							if(newestVNodesConnection.contains((nodeConnection + 1)->node ^ 1)) {
+							if(newestVNodesConnection.contains(nodeConnections.nodes[nodeConnection + 1] ^ 1)) {
 							
 								// Check if solution was found at the connected node's pair
-								if(searchVNodeConnectionsForCuckatooSolution(cycleSize + 1, (nodeConnection + 1)->node ^ 1, &(nodeConnection + 1)->edgeIndex, vNode, newestUNodesConnection, newestVNodesConnection, visitedUNodePairs, visitedVNodePairs)) {
+								if(searchNodeConnectionsForCuckatooSolution(cycleSize + 1, 1, nodeConnections.nodes[nodeConnection + 1] ^ 1, nodeConnections.edgesIndex[nodeConnection / 2], vNode, nodeConnections, newestUNodesConnection, newestVNodesConnection, visitedUNodePairs, visitedVNodePairs)) {
 								
 									// Get solution from visited nodes
 									visitedUNodePairs.getValues(solution);
@@ -117,8 +353,8 @@ bool getCuckatooSolution(const uint32_t edgeIndex, const uint32_t uNode, const u
 			}
 			
 			// Go to node's pair opposite end and get its edge index
-			index = &(nodeConnection + 1)->edgeIndex;
-			node = (nodeConnection + 1)->node;
+			index = nodeConnections.edgesIndex[nodeConnection / 2];
+			node = nodeConnections.nodes[nodeConnection + 1];
 			
 			// Check if node pair was already visited
 			if(visitedVNodePairs.contains(node >> 1)) {
@@ -136,7 +372,7 @@ bool getCuckatooSolution(const uint32_t edgeIndex, const uint32_t uNode, const u
 					// Get solution from visited nodes
 					visitedUNodePairs.getValues(solution);
 					visitedVNodePairs.getValues(&solution[SOLUTION_SIZE / 2]);
-					solution[SOLUTION_SIZE - 1] = *index;
+					solution[SOLUTION_SIZE - 1] = index;
 					
 					// Sort solution in ascending order
 					sort(solution, solution + SOLUTION_SIZE);
@@ -167,20 +403,20 @@ bool getCuckatooSolution(const uint32_t edgeIndex, const uint32_t uNode, const u
 			visitedVNodePairs.setUnique(node >> 1, index);
 			
 			// Check if node's pair has more than one connection
-			nodeConnection = newestVNodesConnection.get(node ^ 1);
-			if(nodeConnection->previousNodeConnection) {
+			nodeConnection = *newestVNodesConnection.get(node ^ 1);
+			if(nodeConnections.previousNodeConnections[nodeConnection] != CUCKATOO_NO_NODE_CONNECTION) {
 			
 				// Go through all of the node's pair's connections
-				for(; nodeConnection; nodeConnection = nodeConnection->previousNodeConnection) {
+				for(; nodeConnection != CUCKATOO_NO_NODE_CONNECTION; nodeConnection = nodeConnections.previousNodeConnections[nodeConnection]) {
 				
 					// Check if the connected node has a pair
-					if(newestUNodesConnection.contains((nodeConnection - 1)->node ^ 1)) {
+					if(newestUNodesConnection.contains(nodeConnections.nodes[nodeConnection - 1] ^ 1)) {
 					
 						// Check if the connected node's pair wasn't already visited
-						if(!visitedUNodePairs.contains((nodeConnection - 1)->node >> 1)) {
+						if(!visitedUNodePairs.contains(nodeConnections.nodes[nodeConnection - 1] >> 1)) {
 						
 							// Check if solution was found at the connected node's pair
-							if(searchUNodeConnectionsForCuckatooSolution(cycleSize + 2, (nodeConnection - 1)->node ^ 1, &(nodeConnection - 1)->edgeIndex, vNode, newestUNodesConnection, newestVNodesConnection, visitedUNodePairs, visitedVNodePairs)) {
+							if(searchNodeConnectionsForCuckatooSolution(cycleSize + 2, 0, nodeConnections.nodes[nodeConnection - 1] ^ 1, nodeConnections.edgesIndex[nodeConnection / 2], vNode, nodeConnections, newestUNodesConnection, newestVNodesConnection, visitedUNodePairs, visitedVNodePairs)) {
 							
 								// Get solution from visited nodes
 								visitedUNodePairs.getValues(solution);
@@ -201,8 +437,8 @@ bool getCuckatooSolution(const uint32_t edgeIndex, const uint32_t uNode, const u
 			}
 			
 			// Go to node's pair opposite end and get its edge index
-			index = &(nodeConnection - 1)->edgeIndex;
-			node = (nodeConnection - 1)->node;
+			index = nodeConnections.edgesIndex[nodeConnection / 2];
+			node = nodeConnections.nodes[nodeConnection - 1];
 			
 			// Check if node pair was already visited
 			if(visitedUNodePairs.contains(node >> 1)) {
@@ -224,86 +460,175 @@ bool getCuckatooSolution(const uint32_t edgeIndex, const uint32_t uNode, const u
 	return false;
 }
 
-// Search u node connections for cuckatoo solution
-bool searchUNodeConnectionsForCuckatooSolution(const int cycleSize, const uint32_t node, const uint32_t *edgeIndex, const uint32_t rootNode, const HashTable<CuckatooNodeConnection, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &newestUNodesConnection, const HashTable<CuckatooNodeConnection, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &newestVNodesConnection, HashTable<uint32_t, SOLUTION_SIZE / 2> &visitedUNodePairs, HashTable<uint32_t, SOLUTION_SIZE / 2> &visitedVNodePairs) {
+// Get cuckatoo component
+uint32_t getCuckatooComponent(uint32_t *edgesComponent, uint32_t edge) {
+
+	// Loop while edge isn't its component's root
+	while(edgesComponent[edge] != edge) {
+	
+		// Point edge at its grandparent and go to it
+		edgesComponent[edge] = edgesComponent[edgesComponent[edge]];
+		edge = edgesComponent[edge];
+	}
+	
+	// Return edge
+	return edge;
+}
+
+// Search node connections for cuckatoo solution
+bool searchNodeConnectionsForCuckatooSolution(const int cycleSize, const int partition, const uint32_t node, const uint32_t edgeIndex, const uint32_t rootNode, const CuckatooNodeConnections &nodeConnections, const HashTable<uint32_t> &newestUNodesConnection, const HashTable<uint32_t> &newestVNodesConnection, HashTable<uint32_t> &visitedUNodePairs, HashTable<uint32_t> &visitedVNodePairs) {
 
-	// Set that node pair has been visited
-	const uint32_t visitedNodePairIndex = visitedUNodePairs.setUniqueAndGetIndex(node >> 1, edgeIndex);
+	// Set that node pair has been visited and start going through its node connections
+	CuckatooSearchFrame frames[SOLUTION_SIZE];
+	frames[0] = {partition ? *newestVNodesConnection.get(node) : *newestUNodesConnection.get(node), (partition ? visitedVNodePairs : visitedUNodePairs).setUniqueAndGetIndex(node >> 1, edgeIndex)};
 	
-	// Go through all of the node's connections
-	for(const CuckatooNodeConnection *nodeConnection = newestUNodesConnection.get(node); nodeConnection; nodeConnection = nodeConnection->previousNodeConnection) {
+	// Loop while frames exist
+	for(int depth = 0; depth >= 0;) {
 	
-		// Check if the connected node's pair wasn't already visited
-		if(!visitedVNodePairs.contains((nodeConnection + 1)->node >> 1)) {
+		// Get frame's cycle size and partition
+		CuckatooSearchFrame &frame = frames[depth];
+		const int frameCycleSize = cycleSize + depth;
+		const int framePartition = (partition + depth) % 2;
 		
-			// Check if cycle is complete
-			if(((nodeConnection + 1)->node ^ 1) == rootNode) {
+		// Check if frame's node connections have all been searched
+		if(frame.nodeConnection == CUCKATOO_NO_NODE_CONNECTION) {
+		
+			// Set that frame's node pair hasn't been visited
+			(framePartition ? visitedVNodePairs : visitedUNodePairs).removeMostRecentSetUique(frame.visitedNodePairIndex);
 			
-				// Check if cycle is a solution
-				if(cycleSize == SOLUTION_SIZE - 1) {
-				
-					// Set that the connected node's pair has been visited
-					visitedVNodePairs.setUnique((nodeConnection + 1)->node >> 1, &(nodeConnection + 1)->edgeIndex);
-					
-					// Return true
-					return true;
-				}
-			}
+			// Go to previous frame
+			--depth;
 			
-			// Otherwise check if cycle could be as solution
-			else if(cycleSize != SOLUTION_SIZE - 1) {
+			// Continue
+			continue;
+		}
+		
+		// Go to the frame's next node connection
+		const uint32_t nodeConnection = frame.nodeConnection;
+		frame.nodeConnection = nodeConnections.previousNodeConnections[nodeConnection];
+		
+		// Check if frame is on the u partition
+		if(!framePartition) {
+		
+			// Check if the connected node's pair wasn't already visited
+			const uint32_t connectedNode = nodeConnections.nodes[nodeConnection + 1];
+			if(!visitedVNodePairs.contains(connectedNode >> 1)) {
 			
-				// Check if the connected node has a pair
-				if(newestVNodesConnection.contains((nodeConnection + 1)->node ^ 1)) {
+				// Check if cycle is complete
+				if((connectedNode ^ 1) == rootNode) {
 				
-					// Check if solution was found at the connected node's pair
-					if(searchVNodeConnectionsForCuckatooSolution(cycleSize + 1, (nodeConnection + 1)->node ^ 1, &(nodeConnection + 1)->edgeIndex, rootNode, newestUNodesConnection, newestVNodesConnection, visitedUNodePairs, visitedVNodePairs)) {
+					// Check if cycle is a solution
+					if(frameCycleSize == SOLUTION_SIZE - 1) {
 					
+						// Set that the connected node's pair has been visited
+						visitedVNodePairs.setUnique(connectedNode >> 1, nodeConnections.edgesIndex[nodeConnection / 2]);
+						
 						// Return true
 						return true;
 					}
 				}
+				
+				// Otherwise check if cycle could be as solution and the connected node has a pair
+				else if(frameCycleSize != SOLUTION_SIZE - 1 && newestVNodesConnection.contains(connectedNode ^ 1)) {
+				
+					// Set that the connected node's pair has been visited and start going through its node connections
+					frames[++depth] = {*newestVNodesConnection.get(connectedNode ^ 1), visitedVNodePairs.setUniqueAndGetIndex(connectedNode >> 1, nodeConnections.edgesIndex[nodeConnection / 2])};
+				}
+			}
+		}
+		
+		// Otherwise
+		else {
+		
+			// Check if the connected node has a pair and the connected node's pair wasn't already visited
+			const uint32_t connectedNode = nodeConnections.nodes[nodeConnection - 1];
+			if(newestUNodesConnection.contains(connectedNode ^ 1) && !visitedUNodePairs.contains(connectedNode >> 1)) {
+			
+				// Set that the connected node's pair has been visited and start going through its node connections
+				frames[++depth] = {*newestUNodesConnection.get(connectedNode ^ 1), visitedUNodePairs.setUniqueAndGetIndex(connectedNode >> 1, nodeConnections.edgesIndex[nodeConnection / 2])};
 			}
 		}
 	}
 	
-	// Set that node pair hasn't been visited
-	visitedUNodePairs.removeMostRecentSetUique(visitedNodePairIndex);
-	
 	// Return false
 	return false;
 }
 
-// Search v node connections for cuckatoo solution
-bool searchVNodeConnectionsForCuckatooSolution(const int cycleSize, const uint32_t node, const uint32_t *edgeIndex, const uint32_t rootNode, const HashTable<CuckatooNodeConnection, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &newestUNodesConnection, const HashTable<CuckatooNodeConnection, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> &newestVNodesConnection, HashTable<uint32_t, SOLUTION_SIZE / 2> &visitedUNodePairs, HashTable<uint32_t, SOLUTION_SIZE / 2> &visitedVNodePairs) {
+// Verify cuckatoo solution
+bool verifyCuckatooSolution(const uint8_t jobHeader[HEADER_SIZE], const uint64_t jobNonce, const uint32_t solution[SOLUTION_SIZE]) {
 
-	// Set that node pair has been visited
-	const uint32_t visitedNodePairIndex = visitedVNodePairs.setUniqueAndGetIndex(node >> 1, edgeIndex);
+	// Get SipHash keys from job header and nonce
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys;
+	blake2b(jobHeader, jobNonce, sipHashKeys);
 	
-	// Go through all of the node's connections
-	for(const CuckatooNodeConnection *nodeConnection = newestVNodesConnection.get(node); nodeConnection; nodeConnection = nodeConnection->previousNodeConnection) {
+	// Go through all of the solution's edges
+	uint32_t nodes[SOLUTION_SIZE * 2];
+	uint32_t uNodesXor = (SOLUTION_SIZE / 2) & 1;
+	uint32_t vNodesXor = uNodesXor;
+	for(int i = 0; i < SOLUTION_SIZE; ++i) {
 	
-		// Check if the connected node has a pair
-		if(newestUNodesConnection.contains((nodeConnection - 1)->node ^ 1)) {
+		// Check if edge is invalid or isn't after the previous edge
+		if(solution[i] >= NUMBER_OF_EDGES || (i && solution[i] <= solution[i - 1])) {
 		
-			// Check if the connected node's pair wasn't already visited
-			if(!visitedUNodePairs.contains((nodeConnection - 1)->node >> 1)) {
+			// Return false
+			return false;
+		}
+		
+		// Get edge's nodes
+		nodes[i * 2] = sipHash24(sipHashKeys, solution[i] * 2) & NODE_MASK;
+		nodes[i * 2 + 1] = sipHash24(sipHashKeys, (solution[i] * 2) | 1) & NODE_MASK;
+		
+		// Include edge's nodes in the nodes xor
+		uNodesXor ^= nodes[i * 2];
+		vNodesXor ^= nodes[i * 2 + 1];
+	}
+	
+	// Check if every edge's node pairs aren't shared with other edges
+	if(uNodesXor || vNodesXor) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Go through all edges in the cycle starting at the first edge's u node
+	int cycleSize = 0;
+	int node = 0;
+	do {
+	
+		// Go through all other nodes in the same partition
+		int connectedNode = node;
+		for(int i = (node + 2) % (SOLUTION_SIZE * 2); i != node; i = (i + 2) % (SOLUTION_SIZE * 2)) {
+		
+			// Check if node is in the same node pair as the node
+			if(nodes[i] >> 1 == nodes[node] >> 1) {
 			
-				// Check if solution was found at the connected node's pair
-				if(searchUNodeConnectionsForCuckatooSolution(cycleSize + 1, (nodeConnection - 1)->node ^ 1, &(nodeConnection - 1)->edgeIndex, rootNode, newestUNodesConnection, newestVNodesConnection, visitedUNodePairs, visitedVNodePairs)) {
+				// Check if the node pair is shared by more than two edges
+				if(connectedNode != node) {
 				
-					// Return true
-					return true;
+					// Return false
+					return false;
 				}
+				
+				// Set connected node to the node
+				connectedNode = i;
 			}
 		}
-	}
+		
+		// Check if the node pair isn't shared with another edge or the other edge has the same node which is a dead end
+		if(connectedNode == node || nodes[connectedNode] == nodes[node]) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Go to the connected node's edge's other node
+		node = connectedNode ^ 1;
+		++cycleSize;
 	
-	// Set that node pair hasn't been visited
-	visitedVNodePairs.removeMostRecentSetUique(visitedNodePairIndex);
+	} while(node);
 	
-	// Return false
-	return false;
+	// Return if the cycle contains all of the solution's edges
+	return cycleSize == SOLUTION_SIZE;
 }
 
 
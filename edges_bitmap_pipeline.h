@@ -0,0 +1,397 @@
+// Header guard
+#ifndef EDGES_BITMAP_PIPELINE_H
+#define EDGES_BITMAP_PIPELINE_H
+
+
+// Header files
+using namespace std;
+
+
+// Constants
+
+// Check if using Linux
+#ifdef __linux__
+
+	// Edges bitmap pipeline number of buffers
+	#define EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS 3
+	
+	// Edges bitmap pipeline max number of tasks
+	#define EDGES_BITMAP_PIPELINE_MAX_NUMBER_OF_TASKS (EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS * 2)
+	
+// Otherwise
+#else
+
+	// Edges bitmap pipeline number of buffers
+	#define EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS 1
+#endif
+
+
+// Classes
+
+// Edges bitmap pipeline class
+class EdgesBitmapPipeline final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit EdgesBitmapPipeline(EdgesBitmapStorage &edgesBitmapStorage, uint32_t *edgesBitmap, const size_t edgesBitmapPartSize, uint32_t *buffers[EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS]);
+		
+		// Destructor
+		inline ~EdgesBitmapPipeline();
+		
+		// Start
+		ITCM_CODE inline void start(const bool writeBack);
+		
+		// Get part
+		ITCM_CODE inline uint32_t *getPart(const size_t partIndex);
+		
+		// Finish part
+		ITCM_CODE inline bool finishPart(const size_t partIndex);
+		
+		// Finish
+		ITCM_CODE inline bool finish();
+	
+	// Private
+	private:
+	
+		// Edges bitmap storage
+		EdgesBitmapStorage &edgesBitmapStorage;
+		
+		// Edges bitmap
+		uint32_t *edgesBitmap;
+		
+		// Edges bitmap part size
+		const size_t edgesBitmapPartSize;
+		
+		// Number of parts
+		const size_t numberOfParts;
+		
+		// Buffers
+		uint32_t *buffers[EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS];
+		
+		// Write back
+		bool writeBack;
+		
+		// Check if using Linux
+		#ifdef __linux__
+		
+			// Edges bitmap pipeline task structure
+			struct EdgesBitmapPipelineTask {
+			
+				// Write
+				bool write;
+				
+				// Buffer index
+				int bufferIndex;
+				
+				// Part index
+				size_t partIndex;
+			};
+			
+			// Add task
+			inline void addTask(const bool write, const int bufferIndex, const size_t partIndex);
+			
+			// Transfer
+			inline void transfer();
+			
+			// Lock
+			mutex lock;
+			
+			// Task added condition
+			condition_variable taskAddedCondition;
+			
+			// Task completed condition
+			condition_variable taskCompletedCondition;
+			
+			// Tasks
+			EdgesBitmapPipelineTask tasks[EDGES_BITMAP_PIPELINE_MAX_NUMBER_OF_TASKS];
+			
+			// Number of added tasks
+			uint64_t numberOfAddedTasks;
+			
+			// Number of completed tasks
+			uint64_t numberOfCompletedTasks;
+			
+			// Buffers read task number
+			uint64_t buffersReadTaskNumber[EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS];
+			
+			// Failed
+			bool failed;
+			
+			// Stop
+			bool stop;
+			
+			// Transfer thread
+			thread transferThread;
+		#endif
+};
+
+
+// Supporting function implementation
+
+// Constructor
+EdgesBitmapPipeline::EdgesBitmapPipeline(EdgesBitmapStorage &edgesBitmapStorage, uint32_t *edgesBitmap, const size_t edgesBitmapPartSize, uint32_t *buffers[EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS]) :
+
+	// Set edges bitmap storage
+	edgesBitmapStorage(edgesBitmapStorage),
+	
+	// Set edges bitmap
+	edgesBitmap(edgesBitmap),
+	
+	// Set edges bitmap part size
+	edgesBitmapPartSize(edgesBitmapPartSize),
+	
+	// Set number of parts
+	numberOfParts(BYTES_PER_BITMAP / edgesBitmapPartSize),
+	
+	// Set write back to false
+	writeBack(false)
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Set number of added tasks to zero
+		, numberOfAddedTasks(0),
+		
+		// Set number of completed tasks to zero
+		numberOfCompletedTasks(0),
+		
+		// Set failed to false
+		failed(false),
+		
+		// Set stop to false
+		stop(false)
+	#endif
+{
+
+	// Go through all buffers
+	for(int i = 0; i < EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS; ++i) {
+	
+		// Set buffer
+		this->buffers[i] = buffers[i];
+	}
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Check if edges bitmap isn't in memory
+		if(!edgesBitmap) {
+		
+			// Start transfer thread
+			transferThread = thread(&EdgesBitmapPipeline::transfer, this);
+		}
+	#endif
+}
+
+// Destructor
+EdgesBitmapPipeline::~EdgesBitmapPipeline() {
+
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Check if transfer thread is running
+		if(transferThread.joinable()) {
+		
+			// Set stop to true
+			unique_lock<mutex> guard(lock);
+			stop = true;
+			guard.unlock();
+			
+			// Wake transfer thread
+			taskAddedCondition.notify_one();
+			
+			// Wait for transfer thread to finish
+			transferThread.join();
+		}
+	#endif
+}
+
+// Start
+void EdgesBitmapPipeline::start(const bool writeBack) {
+
+	// Set write back
+	this->writeBack = writeBack;
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Check if edges bitmap isn't in memory
+		if(!edgesBitmap) {
+		
+			// Go through all buffers that can be prefetched into while the first part is processed
+			for(int i = 0; i < EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS - 1 && static_cast<size_t>(i) < numberOfParts; ++i) {
+			
+				// Read part into its buffer
+				addTask(false, i, i);
+			}
+		}
+	#endif
+}
+
+// Get part
+uint32_t *EdgesBitmapPipeline::getPart(const size_t partIndex) {
+
+	// Check if edges bitmap is in memory
+	if(edgesBitmap) {
+	
+		// Return part in the edges bitmap
+		return &edgesBitmap[partIndex * (edgesBitmapPartSize / sizeof(edgesBitmap[0]))];
+	}
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Wait for the part to be read into its buffer
+		unique_lock<mutex> guard(lock);
+		taskCompletedCondition.wait(guard, [this, partIndex]() {
+		
+			// Return if the part was read or a transfer failed
+			return failed || numberOfCompletedTasks >= buffersReadTaskNumber[partIndex % EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS];
+		});
+		
+		// Return part's buffer if the transfers didn't fail
+		return failed ? nullptr : buffers[partIndex % EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS];
+		
+	// Otherwise
+	#else
+	
+		// Return part's buffer if reading the part into it was successful
+		return edgesBitmapStorage.read(buffers[0], edgesBitmapPartSize, partIndex * edgesBitmapPartSize) ? buffers[0] : nullptr;
+	#endif
+}
+
+// Finish part
+bool EdgesBitmapPipeline::finishPart(const size_t partIndex) {
+
+	// Check if edges bitmap is in memory
+	if(edgesBitmap) {
+	
+		// Return true
+		return true;
+	}
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Check if writing back
+		if(writeBack) {
+		
+			// Write part from its buffer
+			addTask(true, partIndex % EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS, partIndex);
+		}
+		
+		// Check if another part can be prefetched into the buffer after the part's buffer is written back
+		if(partIndex + EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS - 1 < numberOfParts) {
+		
+			// Read other part into its buffer
+			addTask(false, (partIndex + EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS - 1) % EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS, partIndex + EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS - 1);
+		}
+		
+		// Return if the transfers didn't fail
+		const lock_guard<mutex> guard(lock);
+		return !failed;
+		
+	// Otherwise
+	#else
+	
+		// Return if not writing back or writing the part from its buffer was successful
+		return !writeBack || edgesBitmapStorage.write(buffers[0], edgesBitmapPartSize, partIndex * edgesBitmapPartSize);
+	#endif
+}
+
+// Finish
+bool EdgesBitmapPipeline::finish() {
+
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Check if edges bitmap isn't in memory
+		if(!edgesBitmap) {
+		
+			// Wait for all tasks to complete
+			unique_lock<mutex> guard(lock);
+			taskCompletedCondition.wait(guard, [this]() {
+			
+				// Return if all tasks completed
+				return numberOfCompletedTasks == numberOfAddedTasks;
+			});
+			
+			// Return if the transfers didn't fail
+			return !failed;
+		}
+	#endif
+	
+	// Return true
+	return true;
+}
+
+// Check if using Linux
+#ifdef __linux__
+
+	// Add task
+	void EdgesBitmapPipeline::addTask(const bool write, const int bufferIndex, const size_t partIndex) {
+	
+		// Add task to the tasks
+		unique_lock<mutex> guard(lock);
+		tasks[numberOfAddedTasks % EDGES_BITMAP_PIPELINE_MAX_NUMBER_OF_TASKS] = {write, bufferIndex, partIndex};
+		++numberOfAddedTasks;
+		
+		// Check if task is a read
+		if(!write) {
+		
+			// Set buffer's read task number
+			buffersReadTaskNumber[bufferIndex] = numberOfAddedTasks;
+		}
+		
+		// Wake transfer thread
+		guard.unlock();
+		taskAddedCondition.notify_one();
+	}
+	
+	// Transfer
+	void EdgesBitmapPipeline::transfer() {
+	
+		// Loop forever
+		while(true) {
+		
+			// Wait for a task to be added or to stop
+			unique_lock<mutex> guard(lock);
+			taskAddedCondition.wait(guard, [this]() {
+			
+				// Return if stopping or a task exists
+				return stop || numberOfCompletedTasks != numberOfAddedTasks;
+			});
+			
+			// Check if stopping
+			if(stop) {
+			
+				// Return
+				return;
+			}
+			
+			// Get task
+			const EdgesBitmapPipelineTask task = tasks[numberOfCompletedTasks % EDGES_BITMAP_PIPELINE_MAX_NUMBER_OF_TASKS];
+			const bool skip = failed;
+			guard.unlock();
+			
+			// Check if not skipping the task
+			bool result = true;
+			if(!skip) {
+			
+				// Perform the task's transfer
+				result = task.write ? edgesBitmapStorage.write(buffers[task.bufferIndex], edgesBitmapPartSize, task.partIndex * edgesBitmapPartSize) : edgesBitmapStorage.read(buffers[task.bufferIndex], edgesBitmapPartSize, task.partIndex * edgesBitmapPartSize);
+			}
+			
+			// Set that the task completed
+			guard.lock();
+			failed |= !result;
+			++numberOfCompletedTasks;
+			guard.unlock();
+			taskCompletedCondition.notify_all();
+		}
+	}
+#endif
+
+
+#endif
@@ -0,0 +1,886 @@
+// Header guard
+#ifndef EDGES_BITMAP_STORAGE_H
+#define EDGES_BITMAP_STORAGE_H
+
+
+// Header files
+using namespace std;
+
+
+// Constants
+
+// Check if using Linux
+#ifdef __linux__
+
+	// Direct edges bitmap storage alignment
+	#define DIRECT_EDGES_BITMAP_STORAGE_ALIGNMENT 4096
+	
+	// io_uring edges bitmap storage number of entries
+	#define IO_URING_EDGES_BITMAP_STORAGE_NUMBER_OF_ENTRIES 2
+#endif
+
+
+// Enumerations
+
+// Edges bitmap storage type
+enum class EdgesBitmapStorageType {
+
+	// Stream
+	STREAM,
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Positional
+		POSITIONAL,
+		
+		// Memory mapped
+		MEMORY_MAPPED,
+		
+		// Direct
+		DIRECT,
+		
+		// io_uring
+		IO_URING
+	#endif
+};
+
+
+// Classes
+
+// Edges bitmap storage class
+class EdgesBitmapStorage {
+
+	// Public
+	public:
+	
+		// Destructor
+		inline virtual ~EdgesBitmapStorage() = default;
+		
+		// Open
+		virtual bool open(const char *path, const size_t size) = 0;
+		
+		// Read
+		virtual bool read(void *data, const size_t size, const uint64_t offset) = 0;
+		
+		// Write
+		virtual bool write(const void *data, const size_t size, const uint64_t offset) = 0;
+};
+
+// Stream edges bitmap storage class
+class StreamEdgesBitmapStorage final : public EdgesBitmapStorage {
+
+	// Public
+	public:
+	
+		// Open
+		inline virtual bool open(const char *path, const size_t size) override;
+		
+		// Read
+		inline virtual bool read(void *data, const size_t size, const uint64_t offset) override;
+		
+		// Write
+		inline virtual bool write(const void *data, const size_t size, const uint64_t offset) override;
+	
+	// Private
+	private:
+	
+		// File
+		fstream file;
+};
+
+// Check if using Linux
+#ifdef __linux__
+
+	// Positional edges bitmap storage class
+	class PositionalEdgesBitmapStorage : public EdgesBitmapStorage {
+	
+		// Public
+		public:
+		
+			// Constructor
+			inline explicit PositionalEdgesBitmapStorage(const int openFlags = 0);
+			
+			// Destructor
+			inline virtual ~PositionalEdgesBitmapStorage() override;
+			
+			// Open
+			inline virtual bool open(const char *path, const size_t size) override;
+			
+			// Read
+			inline virtual bool read(void *data, const size_t size, const uint64_t offset) override;
+			
+			// Write
+			inline virtual bool write(const void *data, const size_t size, const uint64_t offset) override;
+		
+		// Protected
+		protected:
+		
+			// File descriptor
+			int fileDescriptor;
+		
+		// Private
+		private:
+		
+			// Open flags
+			const int openFlags;
+	};
+	
+	// Memory mapped edges bitmap storage class
+	class MemoryMappedEdgesBitmapStorage final : public EdgesBitmapStorage {
+	
+		// Public
+		public:
+		
+			// Constructor
+			inline explicit MemoryMappedEdgesBitmapStorage();
+			
+			// Destructor
+			inline virtual ~MemoryMappedEdgesBitmapStorage() override;
+			
+			// Open
+			inline virtual bool open(const char *path, const size_t size) override;
+			
+			// Read
+			inline virtual bool read(void *data, const size_t size, const uint64_t offset) override;
+			
+			// Write
+			inline virtual bool write(const void *data, const size_t size, const uint64_t offset) override;
+		
+		// Private
+		private:
+		
+			// Mapping
+			uint8_t *mapping;
+			
+			// Mapping size
+			size_t mappingSize;
+	};
+	
+	// Direct edges bitmap storage class
+	class DirectEdgesBitmapStorage final : public PositionalEdgesBitmapStorage {
+	
+		// Public
+		public:
+		
+			// Constructor
+			inline explicit DirectEdgesBitmapStorage();
+			
+			// Read
+			inline virtual bool read(void *data, const size_t size, const uint64_t offset) override;
+			
+			// Write
+			inline virtual bool write(const void *data, const size_t size, const uint64_t offset) override;
+		
+		// Private
+		private:
+		
+			// Is aligned
+			static inline bool isAligned(const void *data, const size_t size, const uint64_t offset);
+			
+			// Get bounce buffer
+			inline uint8_t *getBounceBuffer(const size_t size);
+			
+			// Bounce buffer
+			unique_ptr<uint8_t, void(*)(void *)> bounceBuffer;
+			
+			// Bounce buffer size
+			size_t bounceBufferSize;
+	};
+	
+	// io_uring edges bitmap storage class
+	class IoUringEdgesBitmapStorage final : public PositionalEdgesBitmapStorage {
+	
+		// Public
+		public:
+		
+			// Constructor
+			inline explicit IoUringEdgesBitmapStorage();
+			
+			// Destructor
+			inline virtual ~IoUringEdgesBitmapStorage() override;
+			
+			// Open
+			inline virtual bool open(const char *path, const size_t size) override;
+			
+			// Read
+			inline virtual bool read(void *data, const size_t size, const uint64_t offset) override;
+			
+			// Write
+			inline virtual bool write(const void *data, const size_t size, const uint64_t offset) override;
+		
+		// Private
+		private:
+		
+			// Create ring
+			inline bool createRing();
+			
+			// Transfer
+			inline bool transfer(const uint8_t operation, uint8_t *data, size_t size, uint64_t offset);
+			
+			// Ring descriptor
+			int ringDescriptor;
+			
+			// Submission ring
+			uint8_t *submissionRing;
+			
+			// Submission ring size
+			size_t submissionRingSize;
+			
+			// Completion ring
+			uint8_t *completionRing;
+			
+			// Completion ring size
+			size_t completionRingSize;
+			
+			// Submission queue entries
+			io_uring_sqe *submissionQueueEntries;
+			
+			// Submission queue entries size
+			size_t submissionQueueEntriesSize;
+			
+			// Ring parameters
+			io_uring_params ringParameters;
+	};
+#endif
+
+
+// Function prototypes
+
+// Create edges bitmap storage
+static inline unique_ptr<EdgesBitmapStorage> createEdgesBitmapStorage(const EdgesBitmapStorageType type);
+
+
+// Supporting function implementation
+
+// Create edges bitmap storage
+unique_ptr<EdgesBitmapStorage> createEdgesBitmapStorage(const EdgesBitmapStorageType type) {
+
+	// Check type
+	switch(type) {
+	
+		// Check if using Linux
+		#ifdef __linux__
+		
+			// Positional
+			case EdgesBitmapStorageType::POSITIONAL:
+			
+				// Return positional edges bitmap storage
+				return unique_ptr<EdgesBitmapStorage>(new (nothrow) PositionalEdgesBitmapStorage());
+			
+			// Memory mapped
+			case EdgesBitmapStorageType::MEMORY_MAPPED:
+			
+				// Return memory mapped edges bitmap storage
+				return unique_ptr<EdgesBitmapStorage>(new (nothrow) MemoryMappedEdgesBitmapStorage());
+			
+			// Direct
+			case EdgesBitmapStorageType::DIRECT:
+			
+				// Return direct edges bitmap storage
+				return unique_ptr<EdgesBitmapStorage>(new (nothrow) DirectEdgesBitmapStorage());
+			
+			// io_uring
+			case EdgesBitmapStorageType::IO_URING:
+			
+				// Return io_uring edges bitmap storage
+				return unique_ptr<EdgesBitmapStorage>(new (nothrow) IoUringEdgesBitmapStorage());
+		#endif
+		
+		// Default
+		default:
+		
+			// Return stream edges bitmap storage
+			return unique_ptr<EdgesBitmapStorage>(new (nothrow) StreamEdgesBitmapStorage());
+	}
+}
+
+// Stream edges bitmap storage open
+bool StreamEdgesBitmapStorage::open(const char *path, [[maybe_unused]] const size_t size) {
+
+	// Close file if it's open
+	if(file.is_open()) {
+	
+		// Close file
+		file.close();
+	}
+	
+	// Clear file's state
+	file.clear();
+	
+	// Return if creating file was successful
+	file.open(path, fstream::in | fstream::out | fstream::binary | fstream::trunc);
+	return static_cast<bool>(file);
+}
+
+// Stream edges bitmap storage read
+bool StreamEdgesBitmapStorage::read(void *data, const size_t size, const uint64_t offset) {
+
+	// Return if going to the offset in the file and reading from it was successful
+	return file.seekg(offset) && file.read(reinterpret_cast<char *>(data), size);
+}
+
+// Stream edges bitmap storage write
+bool StreamEdgesBitmapStorage::write(const void *data, const size_t size, const uint64_t offset) {
+
+	// Return if going to the offset in the file and writing to it was successful
+	return file.seekp(offset) && file.write(reinterpret_cast<const char *>(data), size);
+}
+
+// Check if using Linux
+#ifdef __linux__
+
+	// Positional edges bitmap storage constructor
+	PositionalEdgesBitmapStorage::PositionalEdgesBitmapStorage(const int openFlags) :
+	
+		// Set file descriptor to nothing
+		fileDescriptor(-1),
+		
+		// Set open flags
+		openFlags(openFlags)
+	{
+	}
+	
+	// Positional edges bitmap storage destructor
+	PositionalEdgesBitmapStorage::~PositionalEdgesBitmapStorage() {
+	
+		// Check if file is open
+		if(fileDescriptor != -1) {
+		
+			// Close file
+			close(fileDescriptor);
+		}
+	}
+	
+	// Positional edges bitmap storage open
+	bool PositionalEdgesBitmapStorage::open(const char *path, [[maybe_unused]] const size_t size) {
+	
+		// Check if file is open
+		if(fileDescriptor != -1) {
+		
+			// Close file
+			close(fileDescriptor);
+		}
+		
+		// Return if creating file was successful
+		fileDescriptor = ::open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC | openFlags, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+		return fileDescriptor != -1;
+	}
+	
+	// Positional edges bitmap storage read
+	bool PositionalEdgesBitmapStorage::read(void *data, const size_t size, const uint64_t offset) {
+	
+		// Go through all data to read
+		for(size_t bytesRead = 0; bytesRead != size;) {
+		
+			// Check if reading from the file failed
+			const ssize_t result = pread(fileDescriptor, reinterpret_cast<uint8_t *>(data) + bytesRead, size - bytesRead, offset + bytesRead);
+			if(result <= 0) {
+			
+				// Check if reading wasn't interrupted
+				if(!result || errno != EINTR) {
+				
+					// Return false
+					return false;
+				}
+			}
+			
+			// Otherwise
+			else {
+			
+				// Update bytes read
+				bytesRead += result;
+			}
+		}
+		
+		// Return true
+		return true;
+	}
+	
+	// Positional edges bitmap storage write
+	bool PositionalEdgesBitmapStorage::write(const void *data, const size_t size, const uint64_t offset) {
+	
+		// Go through all data to write
+		for(size_t bytesWritten = 0; bytesWritten != size;) {
+		
+			// Check if writing to the file failed
+			const ssize_t result = pwrite(fileDescriptor, reinterpret_cast<const uint8_t *>(data) + bytesWritten, size - bytesWritten, offset + bytesWritten);
+			if(result <= 0) {
+			
+				// Check if writing wasn't interrupted
+				if(!result || errno != EINTR) {
+				
+					// Return false
+					return false;
+				}
+			}
+			
+			// Otherwise
+			else {
+			
+				// Update bytes written
+				bytesWritten += result;
+			}
+		}
+		
+		// Return true
+		return true;
+	}
+	
+	// Memory mapped edges bitmap storage constructor
+	MemoryMappedEdgesBitmapStorage::MemoryMappedEdgesBitmapStorage() :
+	
+		// Set mapping to nothing
+		mapping(nullptr),
+		
+		// Set mapping size to zero
+		mappingSize(0)
+	{
+	}
+	
+	// Memory mapped edges bitmap storage destructor
+	MemoryMappedEdgesBitmapStorage::~MemoryMappedEdgesBitmapStorage() {
+	
+		// Check if file is mapped
+		if(mapping) {
+		
+			// Unmap file
+			munmap(mapping, mappingSize);
+		}
+	}
+	
+	// Memory mapped edges bitmap storage open
+	bool MemoryMappedEdgesBitmapStorage::open(const char *path, const size_t size) {
+	
+		// Check if file is mapped
+		if(mapping) {
+		
+			// Unmap file
+			munmap(mapping, mappingSize);
+			mapping = nullptr;
+		}
+		
+		// Check if creating file failed
+		const int fileDescriptor = ::open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+		if(fileDescriptor == -1) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Check if resizing file failed
+		if(ftruncate(fileDescriptor, size)) {
+		
+			// Close file
+			close(fileDescriptor);
+			
+			// Return false
+			return false;
+		}
+		
+		// Check if mapping file failed
+		void *result = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+		if(result == MAP_FAILED) {
+		
+			// Close file
+			close(fileDescriptor);
+			
+			// Return false
+			return false;
+		}
+		
+		// Close file
+		close(fileDescriptor);
+		
+		// Set mapping to the result
+		mapping = reinterpret_cast<uint8_t *>(result);
+		mappingSize = size;
+		
+		// Return true
+		return true;
+	}
+	
+	// Memory mapped edges bitmap storage read
+	bool MemoryMappedEdgesBitmapStorage::read(void *data, const size_t size, const uint64_t offset) {
+	
+		// Check if data is outside of the mapping
+		if(offset > mappingSize || size > mappingSize - offset) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Copy data from the mapping
+		memcpy(data, &mapping[offset], size);
+		
+		// Return true
+		return true;
+	}
+	
+	// Memory mapped edges bitmap storage write
+	bool MemoryMappedEdgesBitmapStorage::write(const void *data, const size_t size, const uint64_t offset) {
+	
+		// Check if data is outside of the mapping
+		if(offset > mappingSize || size > mappingSize - offset) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Copy data to the mapping
+		memcpy(&mapping[offset], data, size);
+		
+		// Return true
+		return true;
+	}
+	
+	// Direct edges bitmap storage constructor
+	DirectEdgesBitmapStorage::DirectEdgesBitmapStorage() :
+	
+		// Delegate constructor
+		PositionalEdgesBitmapStorage(O_DIRECT),
+		
+		// Set bounce buffer to nothing
+		bounceBuffer(nullptr, free),
+		
+		// Set bounce buffer size to zero
+		bounceBufferSize(0)
+	{
+	}
+	
+	// Direct edges bitmap storage read
+	bool DirectEdgesBitmapStorage::read(void *data, const size_t size, const uint64_t offset) {
+	
+		// Check if data is aligned
+		if(isAligned(data, size, offset)) {
+		
+			// Return if reading data was successful
+			return PositionalEdgesBitmapStorage::read(data, size, offset);
+		}
+		
+		// Check if getting bounce buffer failed
+		const uint64_t alignedOffset = offset & ~static_cast<uint64_t>(DIRECT_EDGES_BITMAP_STORAGE_ALIGNMENT - 1);
+		const size_t alignedSize = (offset - alignedOffset + size + DIRECT_EDGES_BITMAP_STORAGE_ALIGNMENT - 1) & ~static_cast<size_t>(DIRECT_EDGES_BITMAP_STORAGE_ALIGNMENT - 1);
+		uint8_t *buffer = getBounceBuffer(alignedSize);
+		if(!buffer) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Check if reading aligned data into the bounce buffer failed
+		if(!PositionalEdgesBitmapStorage::read(buffer, alignedSize, alignedOffset)) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Copy data from the bounce buffer
+		memcpy(data, &buffer[offset - alignedOffset], size);
+		
+		// Return true
+		return true;
+	}
+	
+	// Direct edges bitmap storage write
+	bool DirectEdgesBitmapStorage::write(const void *data, const size_t size, const uint64_t offset) {
+	
+		// Check if data is aligned
+		if(isAligned(data, size, offset)) {
+		
+			// Return if writing data was successful
+			return PositionalEdgesBitmapStorage::write(data, size, offset);
+		}
+		
+		// Check if getting bounce buffer failed
+		const uint64_t alignedOffset = offset & ~static_cast<uint64_t>(DIRECT_EDGES_BITMAP_STORAGE_ALIGNMENT - 1);
+		const size_t alignedSize = (offset - alignedOffset + size + DIRECT_EDGES_BITMAP_STORAGE_ALIGNMENT - 1) & ~static_cast<size_t>(DIRECT_EDGES_BITMAP_STORAGE_ALIGNMENT - 1);
+		uint8_t *buffer = getBounceBuffer(alignedSize);
+		if(!buffer) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Check if reading the aligned data around the data into the bounce buffer failed
+		if(!PositionalEdgesBitmapStorage::read(buffer, alignedSize, alignedOffset)) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Copy data to the bounce buffer
+		memcpy(&buffer[offset - alignedOffset], data, size);
+		
+		// Return if writing the bounce buffer was successful
+		return PositionalEdgesBitmapStorage::write(buffer, alignedSize, alignedOffset);
+	}
+	
+	// Direct edges bitmap storage is aligned
+	bool DirectEdgesBitmapStorage::isAligned(const void *data, const size_t size, const uint64_t offset) {
+	
+		// Return if data, size, and offset are aligned
+		return !((reinterpret_cast<uintptr_t>(data) | size | offset) & (DIRECT_EDGES_BITMAP_STORAGE_ALIGNMENT - 1));
+	}
+	
+	// Direct edges bitmap storage get bounce buffer
+	uint8_t *DirectEdgesBitmapStorage::getBounceBuffer(const size_t size) {
+	
+		// Check if bounce buffer is too small
+		if(bounceBufferSize < size) {
+		
+			// Check if allocating bounce buffer failed
+			bounceBuffer.reset(reinterpret_cast<uint8_t *>(aligned_alloc(DIRECT_EDGES_BITMAP_STORAGE_ALIGNMENT, size)));
+			if(!bounceBuffer) {
+			
+				// Set bounce buffer size to zero
+				bounceBufferSize = 0;
+				
+				// Return nothing
+				return nullptr;
+			}
+			
+			// Set bounce buffer size
+			bounceBufferSize = size;
+		}
+		
+		// Return bounce buffer
+		return bounceBuffer.get();
+	}
+	
+	// io_uring edges bitmap storage constructor
+	IoUringEdgesBitmapStorage::IoUringEdgesBitmapStorage() :
+	
+		// Set ring descriptor to nothing
+		ringDescriptor(-1),
+		
+		// Set submission ring to nothing
+		submissionRing(nullptr),
+		
+		// Set submission ring size to zero
+		submissionRingSize(0),
+		
+		// Set completion ring to nothing
+		completionRing(nullptr),
+		
+		// Set completion ring size to zero
+		completionRingSize(0),
+		
+		// Set submission queue entries to nothing
+		submissionQueueEntries(nullptr),
+		
+		// Set submission queue entries size to zero
+		submissionQueueEntriesSize(0),
+		
+		// Clear ring parameters
+		ringParameters({})
+	{
+	}
+	
+	// io_uring edges bitmap storage destructor
+	IoUringEdgesBitmapStorage::~IoUringEdgesBitmapStorage() {
+	
+		// Check if submission queue entries are mapped
+		if(submissionQueueEntries) {
+		
+			// Unmap submission queue entries
+			munmap(submissionQueueEntries, submissionQueueEntriesSize);
+		}
+		
+		// Check if completion ring is mapped separately from the submission ring
+		if(completionRing && completionRing != submissionRing) {
+		
+			// Unmap completion ring
+			munmap(completionRing, completionRingSize);
+		}
+		
+		// Check if submission ring is mapped
+		if(submissionRing) {
+		
+			// Unmap submission ring
+			munmap(submissionRing, submissionRingSize);
+		}
+		
+		// Check if ring exists
+		if(ringDescriptor != -1) {
+		
+			// Close ring
+			close(ringDescriptor);
+		}
+	}
+	
+	// io_uring edges bitmap storage open
+	bool IoUringEdgesBitmapStorage::open(const char *path, const size_t size) {
+	
+		// Return if ring exists or creating it was successful and opening the file was successful
+		return (ringDescriptor != -1 || createRing()) && PositionalEdgesBitmapStorage::open(path, size);
+	}
+	
+	// io_uring edges bitmap storage read
+	bool IoUringEdgesBitmapStorage::read(void *data, const size_t size, const uint64_t offset) {
+	
+		// Return if reading data was successful
+		return transfer(IORING_OP_READ, reinterpret_cast<uint8_t *>(data), size, offset);
+	}
+	
+	// io_uring edges bitmap storage write
+	bool IoUringEdgesBitmapStorage::write(const void *data, const size_t size, const uint64_t offset) {
+	
+		// Return if writing data was successful
+		return transfer(IORING_OP_WRITE, const_cast<uint8_t *>(reinterpret_cast<const uint8_t *>(data)), size, offset);
+	}
+	
+	// io_uring edges bitmap storage create ring
+	bool IoUringEdgesBitmapStorage::createRing() {
+	
+		// Check if creating ring failed
+		ringParameters = {};
+		ringDescriptor = syscall(__NR_io_uring_setup, IO_URING_EDGES_BITMAP_STORAGE_NUMBER_OF_ENTRIES, &ringParameters);
+		if(ringDescriptor == -1) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Get ring sizes
+		submissionRingSize = ringParameters.sq_off.array + ringParameters.sq_entries * sizeof(uint32_t);
+		completionRingSize = ringParameters.cq_off.cqes + ringParameters.cq_entries * sizeof(io_uring_cqe);
+		
+		// Check if the rings can be mapped together
+		if(ringParameters.features & IORING_FEAT_SINGLE_MMAP) {
+		
+			// Set ring sizes to the largest ring size
+			submissionRingSize = completionRingSize = max(submissionRingSize, completionRingSize);
+		}
+		
+		// Check if mapping submission ring failed
+		void *result = mmap(nullptr, submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringDescriptor, IORING_OFF_SQ_RING);
+		if(result == MAP_FAILED) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Set submission ring to the result
+		submissionRing = reinterpret_cast<uint8_t *>(result);
+		
+		// Check if the rings can be mapped together
+		if(ringParameters.features & IORING_FEAT_SINGLE_MMAP) {
+		
+			// Set completion ring to the submission ring
+			completionRing = submissionRing;
+		}
+		
+		// Otherwise
+		else {
+		
+			// Check if mapping completion ring failed
+			result = mmap(nullptr, completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringDescriptor, IORING_OFF_CQ_RING);
+			if(result == MAP_FAILED) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Set completion ring to the result
+			completionRing = reinterpret_cast<uint8_t *>(result);
+		}
+		
+		// Check if mapping submission queue entries failed
+		submissionQueueEntriesSize = ringParameters.sq_entries * sizeof(io_uring_sqe);
+		result = mmap(nullptr, submissionQueueEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringDescriptor, IORING_OFF_SQES);
+		if(result == MAP_FAILED) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Set submission queue entries to the result
+		submissionQueueEntries = reinterpret_cast<io_uring_sqe *>(result);
+		
+		// Return true
+		return true;
+	}
+	
+	// io_uring edges bitmap storage transfer
+	bool IoUringEdgesBitmapStorage::transfer(const uint8_t operation, uint8_t *data, size_t size, uint64_t offset) {
+	
+		// Loop while there's data to transfer
+		while(size) {
+		
+			// Get submission queue entry at the submission queue's tail
+			uint32_t *submissionQueueTail = reinterpret_cast<uint32_t *>(&submissionRing[ringParameters.sq_off.tail]);
+			const uint32_t tail = *submissionQueueTail;
+			const uint32_t index = tail & *reinterpret_cast<const uint32_t *>(&submissionRing[ringParameters.sq_off.ring_mask]);
+			io_uring_sqe &submissionQueueEntry = submissionQueueEntries[index];
+			
+			// Set submission queue entry to the transfer
+			submissionQueueEntry = {};
+			submissionQueueEntry.opcode = operation;
+			submissionQueueEntry.fd = fileDescriptor;
+			submissionQueueEntry.addr = reinterpret_cast<uintptr_t>(data);
+			submissionQueueEntry.len = min(size, static_cast<size_t>(INT32_MAX));
+			submissionQueueEntry.off = offset;
+			
+			// Add submission queue entry to the submission queue
+			reinterpret_cast<uint32_t *>(&submissionRing[ringParameters.sq_off.array])[index] = index;
+			__atomic_store_n(submissionQueueTail, tail + 1, __ATOMIC_RELEASE);
+			
+			// Loop until the transfer is completed
+			uint32_t *completionQueueHead = reinterpret_cast<uint32_t *>(&completionRing[ringParameters.cq_off.head]);
+			const uint32_t *completionQueueTail = reinterpret_cast<const uint32_t *>(&completionRing[ringParameters.cq_off.tail]);
+			for(unsigned int numberToSubmit = 1; __atomic_load_n(completionQueueHead, __ATOMIC_RELAXED) == __atomic_load_n(completionQueueTail, __ATOMIC_ACQUIRE);) {
+			
+				// Check if submitting the transfer and waiting for it to complete failed
+				const long result = syscall(__NR_io_uring_enter, ringDescriptor, numberToSubmit, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+				if(result == -1) {
+				
+					// Check if submitting wasn't interrupted
+					if(errno != EINTR) {
+					
+						// Return false
+						return false;
+					}
+				}
+				
+				// Otherwise
+				else {
+				
+					// Set that the transfer was submitted
+					numberToSubmit = 0;
+				}
+			}
+			
+			// Get the transfer's completion queue entry and remove it from the completion queue
+			const uint32_t head = *completionQueueHead;
+			const int32_t transferred = reinterpret_cast<const io_uring_cqe *>(&completionRing[ringParameters.cq_off.cqes])[head & *reinterpret_cast<const uint32_t *>(&completionRing[ringParameters.cq_off.ring_mask])].res;
+			__atomic_store_n(completionQueueHead, head + 1, __ATOMIC_RELEASE);
+			
+			// Check if the transfer failed
+			if(transferred <= 0) {
+			
+				// Check if the transfer wasn't interrupted
+				if(transferred != -EINTR && transferred != -EAGAIN) {
+				
+					// Return false
+					return false;
+				}
+			}
+			
+			// Otherwise
+			else {
+			
+				// Update remaining data
+				data += transferred;
+				size -= transferred;
+				offset += transferred;
+			}
+		}
+		
+		// Return true
+		return true;
+	}
+#endif
+
+
+#endif
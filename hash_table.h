@@ -7,10 +7,22 @@
 using namespace std;
 
 
+// Constants
+
+// Hash table empty key
+#define HASH_TABLE_EMPTY_KEY UINT32_MAX
+
+// Hash table group size
+#define HASH_TABLE_GROUP_SIZE 8
+
+
 // Classes
 
+// Hash table group
+typedef uint32_t __attribute__((vector_size(sizeof(uint32_t) * HASH_TABLE_GROUP_SIZE))) HashTableGroup;
+
 // Hash table class
-template<typename ValueType, const uint32_t size> class HashTable final {
+template<typename ValueType> class HashTable final {
 
 	// Public
 	public:
@@ -18,14 +30,17 @@ template<typename ValueType, const uint32_t size> class HashTable final {
 		// Constructor
 		inline explicit HashTable();
 		
+		// Reserve
+		inline bool reserve(const uint32_t size);
+		
 		// Set unique
-		ITCM_CODE inline void setUnique(const uint32_t key, const ValueType *value);
+		ITCM_CODE inline void setUnique(const uint32_t key, const ValueType &value);
 		
 		// Set unique and get index
-		ITCM_CODE inline uint32_t setUniqueAndGetIndex(const uint32_t key, const ValueType *value);
+		ITCM_CODE inline uint32_t setUniqueAndGetIndex(const uint32_t key, const ValueType &value);
 		
 		// Replace
-		ITCM_CODE inline const ValueType *replace(const uint32_t key, const ValueType *value);
+		ITCM_CODE inline bool replace(const uint32_t key, const ValueType &value, ValueType &currentValue);
 		
 		// Remove most recent set unique
 		ITCM_CODE inline void removeMostRecentSetUique(const uint32_t index);
@@ -45,227 +60,276 @@ template<typename ValueType, const uint32_t size> class HashTable final {
 	// Private
 	private:
 	
-		// Hash table entry structure
-		struct HashTableEntry {
+		// Find
+		ITCM_CODE inline bool find(const uint32_t key, uint32_t &index) const;
 		
-			// Key
-			uint32_t key;
-			
-			// Value
-			const ValueType *value;
-		};
+		// Get group entries
+		ITCM_CODE inline uint32_t getGroupEntries(const uint32_t groupIndex, const uint32_t key) const;
+		
+		// Set entry
+		ITCM_CODE inline void setEntry(const uint32_t index, const uint32_t key, const ValueType &value);
+		
+		// Keys
+		unique_ptr<uint32_t[]> keys;
+		
+		// Values
+		unique_ptr<ValueType[]> values;
+		
+		// Groups generation
+		unique_ptr<uint32_t[]> groupsGeneration;
 		
-		// Entries
-		HashTableEntry entries[bit_ceil(size + 1)];
+		// Number of entries
+		uint32_t numberOfEntries;
+		
+		// Generation
+		uint32_t generation;
 };
 
 
 // Supporting function implementation
 
 // Constructor
-template<typename ValueType, const uint32_t size> HashTable<ValueType, size>::HashTable() {
+template<typename ValueType> HashTable<ValueType>::HashTable() :
 
-	// Throw error is size is invalid
-	static_assert(size <= bit_ceil(UINT32_MAX >> 1) - 1, "Hash table's size is invalid");
+	// Set number of entries to zero
+	numberOfEntries(0),
 	
-	// Clear entries
-	memset(entries, 0, sizeof(entries));
+	// Set generation to zero
+	generation(0)
+{
 }
 
-// Set unique
-template<typename ValueType, const uint32_t size> void HashTable<ValueType, size>::setUnique(const uint32_t key, const ValueType *value) {
+// Reserve
+template<typename ValueType> bool HashTable<ValueType>::reserve(const uint32_t size) {
 
-	// Get key's index
-	uint32_t index = key % (sizeof(entries) / sizeof(entries[0]));
+	// Check if size is invalid
+	if(size > bit_ceil(UINT32_MAX >> 1) - 1) {
 	
-	// Loop while entry at index exists
-	while(entries[index].value) {
+		// Return false
+		return false;
+	}
 	
-		// Check if index isn't for the last entry
-		if(index != (sizeof(entries) / sizeof(entries[0])) - 1) {
-		
-			// Increment index
-			++index;
+	// Check if entries can't already hold the size
+	const uint32_t newNumberOfEntries = max(bit_ceil(size + 1), static_cast<uint32_t>(HASH_TABLE_GROUP_SIZE));
+	if(newNumberOfEntries > numberOfEntries) {
+	
+		// Free keys, values, and groups generation
+		keys.reset();
+		values.reset();
+		groupsGeneration.reset();
+		numberOfEntries = 0;
+		
+		// Check if creating keys, values, and groups generation failed
+		keys = unique_ptr<uint32_t[]>(new(nothrow) uint32_t[newNumberOfEntries]);
+		values = unique_ptr<ValueType[]>(new(nothrow) ValueType[newNumberOfEntries]);
+		groupsGeneration = unique_ptr<uint32_t[]>(new(nothrow) uint32_t[newNumberOfEntries / HASH_TABLE_GROUP_SIZE]);
+		if(!keys || !values || !groupsGeneration) {
+		
+			// Free keys, values, and groups generation
+			keys.reset();
+			values.reset();
+			groupsGeneration.reset();
+			
+			// Return false
+			return false;
 		}
 		
-		// Otherwise
-		else {
+		// Set number of entries
+		numberOfEntries = newNumberOfEntries;
 		
-			// Set index to the first entry
-			index = 0;
-		}
+		// Set that all groups are from before the first generation
+		memset(groupsGeneration.get(), 0, sizeof(groupsGeneration[0]) * (numberOfEntries / HASH_TABLE_GROUP_SIZE));
+		generation = 0;
 	}
 	
-	// Set entry at index to the value
-	entries[index] = {key, value};
+	// Clear entries
+	clear();
+	
+	// Return true
+	return true;
+}
+
+// Set unique
+template<typename ValueType> void HashTable<ValueType>::setUnique(const uint32_t key, const ValueType &value) {
+
+	// Set unique and get index
+	setUniqueAndGetIndex(key, value);
 }
 
 // Set unique and get index
-template<typename ValueType, const uint32_t size> uint32_t HashTable<ValueType, size>::setUniqueAndGetIndex(const uint32_t key, const ValueType *value) {
+template<typename ValueType> uint32_t HashTable<ValueType>::setUniqueAndGetIndex(const uint32_t key, const ValueType &value) {
 
-	// Get key's index
-	uint32_t index = key % (sizeof(entries) / sizeof(entries[0]));
-	
-	// Loop while entry at index exists
-	while(entries[index].value) {
-	
-		// Check if index isn't for the last entry
-		if(index != (sizeof(entries) / sizeof(entries[0])) - 1) {
-		
-			// Increment index
-			++index;
-		}
-		
-		// Otherwise
-		else {
-		
-			// Set index to the first entry
-			index = 0;
-		}
-	}
+	// Get the key's first empty entry
+	uint32_t index;
+	find(key, index);
 	
 	// Set entry at index to the value
-	entries[index] = {key, value};
+	setEntry(index, key, value);
 	
 	// Return index
 	return index;
 }
 
 // Replace
-template<typename ValueType, const uint32_t size> const ValueType *HashTable<ValueType, size>::replace(const uint32_t key, const ValueType *value) {
+template<typename ValueType> bool HashTable<ValueType>::replace(const uint32_t key, const ValueType &value, ValueType &currentValue) {
 
-	// Get key's index
-	uint32_t index = key % (sizeof(entries) / sizeof(entries[0]));
-	
-	// Loop while entry at index exists
-	while(entries[index].value) {
+	// Check if entry with the same key exists
+	uint32_t index;
+	if(find(key, index)) {
 	
-		// Check if entry has the same key
-		if(entries[index].key == key) {
-		
-			// Get current value
-			const ValueType *currentValue = entries[index].value;
-			
-			// Set entry at index to the value
-			entries[index].value = value;
-			
-			// Return current value
-			return currentValue;
-		}
-		
-		// Check if index isn't for the last entry
-		if(index != (sizeof(entries) / sizeof(entries[0])) - 1) {
+		// Get current value
+		currentValue = values[index];
 		
-			// Increment index
-			++index;
-		}
+		// Set entry at index to the value
+		values[index] = value;
 		
-		// Otherwise
-		else {
-		
-			// Set index to the first entry
-			index = 0;
-		}
+		// Return true
+		return true;
 	}
 	
 	// Set entry at index to the value
-	entries[index] = {key, value};
+	setEntry(index, key, value);
 	
-	// Return nothing
-	return nullptr;
+	// Return false
+	return false;
 }
 
 // Remove most recent set unique
-template<typename ValueType, const uint32_t size> void HashTable<ValueType, size>::removeMostRecentSetUique(const uint32_t index) {
+template<typename ValueType> void HashTable<ValueType>::removeMostRecentSetUique(const uint32_t index) {
 
 	// Clear entry at index
-	entries[index].value = nullptr;
+	keys[index] = HASH_TABLE_EMPTY_KEY;
 }
 
 // Clear
-template<typename ValueType, const uint32_t size> void HashTable<ValueType, size>::clear() {
+template<typename ValueType> void HashTable<ValueType>::clear() {
 
-	// Clear entries
-	memset(entries, 0, sizeof(entries));
+	// Go to the next generation so that all groups are from a previous generation
+	++generation;
+	
+	// Check if generation wrapped around
+	if(!generation) {
+	
+		// Set that all groups are from before the first generation
+		memset(groupsGeneration.get(), 0, sizeof(groupsGeneration[0]) * (numberOfEntries / HASH_TABLE_GROUP_SIZE));
+		generation = 1;
+	}
 }
 
 // Contains
-template<typename ValueType, const uint32_t size> bool HashTable<ValueType, size>::contains(const uint32_t key) const {
+template<typename ValueType> bool HashTable<ValueType>::contains(const uint32_t key) const {
 
-	// Go through all existing entries starting at the key's index
-	for(uint32_t index = key % (sizeof(entries) / sizeof(entries[0])); entries[index].value;) {
+	// Return if entry with the same key exists
+	uint32_t index;
+	return find(key, index);
+}
+
+// Get
+template<typename ValueType> const ValueType *HashTable<ValueType>::get(const uint32_t key) const {
+
+	// Return entry's value if entry with the same key exists
+	uint32_t index;
+	return find(key, index) ? &values[index] : nullptr;
+}
+
+// Get values
+template<typename ValueType> void HashTable<ValueType>::getValues(ValueType *values) const {
+
+	// Go through all groups
+	for(uint32_t groupIndex = 0, valuesIndex = 0; groupIndex < numberOfEntries / HASH_TABLE_GROUP_SIZE; ++groupIndex) {
 	
-		// Check if entry has the same key
-		if(entries[index].key == key) {
-		
-			// Return true
-			return true;
-		}
-		
-		// Check if index isn't for the last entry
-		if(index != (sizeof(entries) / sizeof(entries[0])) - 1) {
-		
-			// Increment index
-			++index;
-		}
+		// Check if group is from the current generation
+		if(groupsGeneration[groupIndex] == generation) {
 		
-		// Otherwise
-		else {
-		
-			// Set index to the first entry
-			index = 0;
+			// Go through all of the group's entries
+			for(uint32_t index = groupIndex * HASH_TABLE_GROUP_SIZE; index < (groupIndex + 1) * HASH_TABLE_GROUP_SIZE; ++index) {
+			
+				// Check if entry exists
+				if(keys[index] != HASH_TABLE_EMPTY_KEY) {
+				
+					// Set value in values
+					values[valuesIndex++] = this->values[index];
+				}
+			}
 		}
 	}
-	
-	// Return false
-	return false;
 }
 
-// Get
-template<typename ValueType, const uint32_t size> const ValueType *HashTable<ValueType, size>::get(const uint32_t key) const {
+// Find
+template<typename ValueType> bool HashTable<ValueType>::find(const uint32_t key, uint32_t &index) const {
 
-	// Go through all existing entries starting at the key's index
-	for(uint32_t index = key % (sizeof(entries) / sizeof(entries[0])); entries[index].value;) {
+	// Go through all groups starting at the key's group
+	for(uint32_t groupIndex = (key & (numberOfEntries - 1)) / HASH_TABLE_GROUP_SIZE;; groupIndex = (groupIndex + 1) & (numberOfEntries / HASH_TABLE_GROUP_SIZE - 1)) {
 	
-		// Check if entry has the same key
-		if(entries[index].key == key) {
+		// Check if group is from a previous generation
+		if(groupsGeneration[groupIndex] != generation) {
 		
-			// Return entry's value
-			return entries[index].value;
+			// Set index to the group's first entry
+			index = groupIndex * HASH_TABLE_GROUP_SIZE;
+			
+			// Return false
+			return false;
 		}
 		
-		// Check if index isn't for the last entry
-		if(index != (sizeof(entries) / sizeof(entries[0])) - 1) {
+		// Check if group contains the key
+		const uint32_t matchingEntries = getGroupEntries(groupIndex, key);
+		if(matchingEntries) {
 		
-			// Increment index
-			++index;
+			// Set index to the matching entry
+			index = groupIndex * HASH_TABLE_GROUP_SIZE + __builtin_ctz(matchingEntries);
+			
+			// Return true
+			return true;
 		}
 		
-		// Otherwise
-		else {
+		// Check if group contains an empty entry
+		const uint32_t emptyEntries = getGroupEntries(groupIndex, HASH_TABLE_EMPTY_KEY);
+		if(emptyEntries) {
 		
-			// Set index to the first entry
-			index = 0;
+			// Set index to the group's first empty entry
+			index = groupIndex * HASH_TABLE_GROUP_SIZE + __builtin_ctz(emptyEntries);
+			
+			// Return false
+			return false;
 		}
 	}
+}
+
+// Get group entries
+template<typename ValueType> uint32_t HashTable<ValueType>::getGroupEntries(const uint32_t groupIndex, const uint32_t key) const {
+
+	// Compare all of the group's keys with the key at once
+	HashTableGroup group;
+	memcpy(&group, &keys[groupIndex * HASH_TABLE_GROUP_SIZE], sizeof(group));
+	const HashTableGroup entries = (group == key) & HashTableGroup{1 << 0, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7};
+	
+	// Go through all of the group's entries
+	uint32_t result = 0;
+	for(int i = 0; i < HASH_TABLE_GROUP_SIZE; ++i) {
+	
+		// Set entry's bit in the result if it has the key
+		result |= entries[i];
+	}
 	
-	// Return nothing
-	return nullptr;
+	// Return result
+	return result;
 }
 
-// Get values
-template<typename ValueType, const uint32_t size> void HashTable<ValueType, size>::getValues(ValueType *values) const {
+// Set entry
+template<typename ValueType> void HashTable<ValueType>::setEntry(const uint32_t index, const uint32_t key, const ValueType &value) {
 
-	// Go through all entries
-	for(uint32_t index = 0, valuesIndex = 0; index < (sizeof(entries) / sizeof(entries[0])); ++index) {
+	// Check if entry's group is from a previous generation
+	const uint32_t groupIndex = index / HASH_TABLE_GROUP_SIZE;
+	if(groupsGeneration[groupIndex] != generation) {
 	
-		// Check if entry exists
-		if(entries[index].value) {
-		
-			// Set value in values
-			values[valuesIndex++] = *entries[index].value;
-		}
+		// Clear group's keys and set that it's from the current generation
+		memset(&keys[groupIndex * HASH_TABLE_GROUP_SIZE], UINT8_MAX, sizeof(keys[0]) * HASH_TABLE_GROUP_SIZE);
+		groupsGeneration[groupIndex] = generation;
 	}
+	
+	// Set entry at index to the key and value
+	keys[index] = key;
+	values[index] = value;
 }
 
 
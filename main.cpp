@@ -12,6 +12,9 @@
 // Milliseconds in a second
 #define MILLISECONDS_IN_A_SECOND 1000
 
+// Microseconds in a millisecond
+#define MICROSECONDS_IN_A_MILLISECOND 1000
+
 // Check if using cuckatoo18
 #ifdef CUCKATOO18
 
@@ -26,7 +29,7 @@
 	
 	// Secondary local RAM size
 	#define SECONDARY_LOCAL_RAM_SIZE LOCAL_RAM_SIZE
-	
+
 // Otherwise
 #else
 
@@ -43,6 +46,9 @@
 	#define SECONDARY_LOCAL_RAM_SIZE (1 * KILOBYTES_IN_A_MEGABYTE * BYTES_IN_A_KILOBYTE)
 #endif
 
+// Max trimming rounds
+#define MAX_TRIMMING_ROUNDS (TRIMMING_ROUNDS * 2)
+
 // Number of edges
 #define NUMBER_OF_EDGES (static_cast<uint32_t>(1) << EDGE_BITS)
 
@@ -64,6 +70,9 @@
 // Solution size
 #define SOLUTION_SIZE 42
 
+// Max number of solutions
+#define MAX_NUMBER_OF_SOLUTIONS 8
+
 // Stratum settings file
 #define STRATUM_SETTINGS_FILE "stratum_server_settings.txt"
 
@@ -85,6 +94,15 @@
 // Stratum server response buffer size
 #define STRATUM_SERVER_RESPONSE_BUFFER_SIZE (10 * BYTES_IN_A_KILOBYTE)
 
+// Submit request size
+#define SUBMIT_REQUEST_SIZE (sizeof("{\"id\":\"") - sizeof('\0') + sizeof("4294967295") - sizeof('\0') + sizeof("\",\"jsonrpc\":\"2.0\",\"method\":\"submit\",\"params\":{\"edge_bits\":" TO_STRING(EDGE_BITS) ",\"height\":") - sizeof('\0') + sizeof("18446744073709551615") - sizeof('\0') + sizeof(",\"job_id\":") - sizeof('\0') + sizeof("18446744073709551615") - sizeof('\0') + sizeof(",\"nonce\":") - sizeof('\0') + sizeof("18446744073709551615") - sizeof('\0') + sizeof(",\"pow\":[") - sizeof('\0') + (sizeof("4294967295,") - sizeof('\0')) * SOLUTION_SIZE - sizeof(',') + sizeof("]}}\n"))
+
+// First submit request ID
+#define FIRST_SUBMIT_REQUEST_ID 2
+
+// Stale share error code
+#define STALE_SHARE_ERROR_CODE -32503
+
 // Frames per second
 #define FRAMES_PER_SECOND 60
 
@@ -100,9 +118,53 @@
 // Edges bitmap file
 #define EDGES_BITMAP_FILE "edges_bitmap.bin"
 
+// Edges bitmap block size
+#define EDGES_BITMAP_BLOCK_SIZE (4 * BYTES_IN_A_KILOBYTE)
+
 // Max number of edges after trimming
 #define MAX_NUMBER_OF_EDGES_AFTER_TRIMMING 65535
 
+// Check if using Linux
+#ifdef __linux__
+
+	// Max number of searched edges
+	#define MAX_NUMBER_OF_SEARCHED_EDGES (NUMBER_OF_EDGES / 2)
+
+// Otherwise
+#else
+
+	// Max number of searched edges
+	#define MAX_NUMBER_OF_SEARCHED_EDGES MAX_NUMBER_OF_EDGES_AFTER_TRIMMING
+#endif
+
+// Search bytes per edge
+#define SEARCH_BYTES_PER_EDGE (CUCKATOO_NODE_CONNECTIONS_BYTES_PER_EDGE + sizeof(uint32_t) * 2 * 2 * 2)
+
+// Search cancellation check interval
+#define SEARCH_CANCELLATION_CHECK_INTERVAL 1024
+
+// Max number of trimming threads
+#define MAX_NUMBER_OF_TRIMMING_THREADS 1024
+
+// Edges batch size
+#define EDGES_BATCH_SIZE 128
+
+// Reserved memory size
+#define RESERVED_MEMORY_SIZE (256 * KILOBYTES_IN_A_MEGABYTE * BYTES_IN_A_KILOBYTE)
+
+// Check if using Linux
+#ifdef __linux__
+
+	// Compact edge list threshold
+	#define COMPACT_EDGE_LIST_THRESHOLD (NUMBER_OF_EDGES >> 7)
+
+// Otherwise
+#else
+
+	// Compact edge list threshold
+	#define COMPACT_EDGE_LIST_THRESHOLD (NUMBER_OF_EDGES >> 16)
+#endif
+
 // To string
 #define STRINGIFY(x) #x
 #define TO_STRING(x) STRINGIFY(x)
@@ -145,7 +207,7 @@
 		
 		// RAM unlock
 		#define ram_unlock() (new volatile uint16_t[ram_size() / sizeof(volatile uint16_t)])
-		
+	
 	// Otherwise
 	#else
 	
@@ -175,13 +237,16 @@
 	#define Wifi_Timer void
 	
 	// CPU start timing
-	#define cpuStartTiming void
+	#define cpuStartTiming(timer) void(cpuTimingStart = chrono::steady_clock::now())
+	
+	// CPU get timing
+	#define cpuGetTiming() (chrono::steady_clock::now() - cpuTimingStart)
 	
 	// CPU end timing
 	#define cpuEndTiming void
 	
 	// Timer ticks to milliseconds
-	#define timerTicks2msec(x) 0
+	#define timerTicks2msec(ticks) chrono::duration_cast<chrono::milliseconds>(ticks).count()
 	
 	// Scan keys
 	#define scanKeys void
@@ -206,9 +271,6 @@
 	
 	// iprintf
 	#define iprintf printf
-	
-	// siprintf
-	#define siprintf sprintf
 #endif
 
 
@@ -216,9 +278,21 @@
 #ifdef __linux__
 
 	// Header files
+	#include <chrono>
+	#include <condition_variable>
+	#include <fcntl.h>
+	#include <functional>
+	#include <linux/io_uring.h>
+	#include <mutex>
+	#include <poll.h>
+	#include <sys/eventfd.h>
 	#include <sys/ioctl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <sys/syscall.h>
 	#include <thread>
-	
+	#include <unistd.h>
+
 // Otherwise
 #else
 
@@ -248,32 +322,134 @@
 #include <random>
 #include "./blake2b.h"
 #include "./hash_table.h"
-#include "./cuckatoo.h"
+#include "./compact_edge_list.h"
 #include "./siphash.h"
+#include "./cuckatoo.h"
+#include "./edges_bitmap_storage.h"
+#include "./edges_bitmap_pipeline.h"
+#include "./stratum_mailbox.h"
+#include "./stratum_codec.h"
+#include "./stratum_share_tracker.h"
+
+// Check if using Linux
+#ifdef __linux__
+
+	// Header files
+	#include "./thread_pool.h"
+	#include "./mean_trimmer.h"
+	#include "./trimmed_graph.h"
+#endif
 
 using namespace std;
 
 
+// Enumerations
+
+// Trimming result
+enum class TrimmingResult {
+
+	// Succeeded
+	SUCCEEDED,
+	
+	// Failed
+	FAILED,
+	
+	// Abandoned
+	ABANDONED,
+	
+	// Cancelled
+	CANCELLED
+};
+
+
 // Global variables
 
 // Console
 static PrintConsole *console;
 
-// Next job height
-static uint64_t nextJobHeight;
+// Next job mailbox
+static StratumJobMailbox nextJobMailbox;
+
+// Stratum response line buffer
+static StratumLineBuffer stratumResponseLineBuffer;
+
+// Stratum share tracker
+static StratumShareTracker stratumShareTracker;
+
+// Mining job height
+static uint64_t miningJobHeight;
 
-// Next job ID
-static uint64_t nextJobId;
+// Edges bitmap storage type
+static EdgesBitmapStorageType edgesBitmapStorageType = EdgesBitmapStorageType::STREAM;
+
+// Prefer edges bitmap in memory
+static bool preferEdgesBitmapInMemory = true;
+
+// Compact edge list threshold
+static size_t compactEdgeListThreshold = COMPACT_EDGE_LIST_THRESHOLD;
+
+// Trimming target number of edges
+static size_t trimmingTargetNumberOfEdges = 0;
+
+// Check if using Linux
+#ifdef __linux__
+
+	// Trimming threads
+	static unique_ptr<ThreadPool> trimmingThreads;
+	
+	// Trimmer type
+	static TrimmerType trimmerType = TrimmerType::LEAN;
+	
+	// Max nodes bitmap part size
+	static size_t maxNodesBitmapPartSize = 0;
+	
+	// Dump trimmed graph directory
+	static const char *dumpTrimmedGraphDirectory = nullptr;
+	
+	// Dump trimmed graph nodes
+	static bool dumpTrimmedGraphNodes = false;
+	
+	// Replay trimmed graph path
+	static const char *replayTrimmedGraphPath = nullptr;
+	
+	// Stratum submission queue
+	static StratumSubmissionQueue stratumSubmissionQueue;
+	
+	// Stratum thread
+	static thread stratumThread;
+	
+	// Stratum thread wake descriptor
+	static int stratumThreadWakeDescriptor = -1;
+	
+	// Stratum thread connected
+	static bool stratumThreadConnected;
+	
+	// CPU timing start
+	static thread_local chrono::steady_clock::time_point cpuTimingStart;
 
-// Next job header
-static uint8_t nextJobHeader[HEADER_SIZE];
+// Otherwise
+#else
 
-// New next job
-static bool newNextJob;
+	// Stratum timer seconds
+	static uint32_t stratumTimerSeconds;
+#endif
 
 
 // Function prototypes
 
+// Check if using Linux
+#ifdef __linux__
+
+	// Parse command line arguments
+	static inline bool parseCommandLineArguments(const int argc, char *argv[]);
+	
+	// Replay trimmed graph
+	static inline bool replayTrimmedGraph(const char *path);
+	
+	// Run stratum thread
+	static inline void runStratumThread(const int socketDescriptor, const uint64_t jobHeight);
+#endif
+
 // Wait for input to exit
 ITCM_CODE [[noreturn]] static inline void waitForInputToExit();
 
@@ -284,26 +460,65 @@ ITCM_CODE static inline void displayModel();
 static inline unique_ptr<int, void(*)(int *)> connectToStratumServer();
 
 // Process stratum server response
-ITCM_CODE static inline bool processStratumServerResponse(char response[STRATUM_SERVER_RESPONSE_BUFFER_SIZE]);
+ITCM_CODE static inline bool processStratumServerResponse(const char *response, const size_t size);
+
+// Get stratum time milliseconds
+ITCM_CODE static inline uint32_t getStratumTimeMilliseconds();
+
+// Wait for socket
+ITCM_CODE static inline bool waitForSocket(const int socketDescriptor, const bool sending, const long timeoutMilliseconds);
 
 // Send full
 ITCM_CODE static inline bool sendFull(const int socketDescriptor, const char *data, size_t size);
 
 // Receive full
-ITCM_CODE static inline bool receiveFull(const int socketDescriptor, char *data, const size_t size);
+ITCM_CODE static inline bool receiveFull(const int socketDescriptor, const char *&lines, size_t &size);
+
+// Is memory available
+static inline bool isMemoryAvailable(const size_t size);
+
+// Is mining job cancelled
+ITCM_CODE static inline bool isMiningJobCancelled();
 
 // Mine job
-ITCM_CODE static inline bool mineJob(const uint8_t jobHeader[HEADER_SIZE], const uint64_t jobNonce, volatile uint16_t *expansionRam, uint32_t solution[SOLUTION_SIZE]);
+ITCM_CODE static inline size_t mineJob(const uint8_t jobHeader[HEADER_SIZE], const uint64_t jobNonce, volatile uint16_t *expansionRam, uint32_t solutions[MAX_NUMBER_OF_SOLUTIONS][SOLUTION_SIZE]);
 
 // Trim edges
-ITCM_CODE static inline bool trimEdges(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, fstream &edgesBitmapFile, volatile uint16_t *expansionRam);
+ITCM_CODE static inline TrimmingResult trimEdges(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, EdgesBitmapStorage &edgesBitmapStorage, uint32_t *edgesBitmap, volatile uint16_t *expansionRam, CompactEdgeList &compactEdgeList, size_t &numberOfEdges, int &numberOfTrimmingRounds);
+
+// Enable nodes in nodes bitmap part
+ITCM_CODE static inline void enableNodesInNodesBitmapPart(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *edgesBitmapPart, const size_t startingGroupIndex, const size_t endingGroupIndex, const uint32_t firstEdgeIndex, const int partition, const size_t nodesBitmapPartIndex, const int divideByNodesBitmapPartSizeShiftRight, const int moduloByNodesBitmapPartSizeBitsAnd, volatile uint16_t *nodesBitmapPart, const bool atomic);
+
+// Disable edges without pairs in edges bitmap part
+ITCM_CODE static inline size_t disableEdgesWithoutPairsInEdgesBitmapPart(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, uint32_t *edgesBitmapPart, const size_t startingGroupIndex, const size_t endingGroupIndex, const uint32_t firstEdgeIndex, const int partition, const size_t nodesBitmapPartIndex, const int divideByNodesBitmapPartSizeShiftRight, const int moduloByNodesBitmapPartSizeBitsAnd, const volatile uint16_t *nodesBitmapPart);
+
+// Trim edges using edge buckets
+ITCM_CODE static inline bool trimEdgesUsingEdgeBuckets(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, uint32_t *edgesBitmap, const int partition, const int divideByNodesBitmapPartSizeShiftRight, const int moduloByNodesBitmapPartSizeBitsAnd, volatile uint16_t *nodesBitmapPart, const size_t nodesBitmapPartSize, size_t &numberOfEdges, bool &cancelled);
+
+// Count edges in edges bitmap
+ITCM_CODE static inline size_t countEdgesInEdgesBitmap(const uint32_t *edgesBitmap, const size_t startingGroupIndex, const size_t endingGroupIndex);
+
+// Hash edges in edges bitmap
+ITCM_CODE static inline void hashEdgesInEdgesBitmap(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *edgesBitmap, const size_t startingGroupIndex, const size_t endingGroupIndex, const int partition, const int divideByNodesBitmapPartSizeShiftRight, uint32_t *edgesNode, size_t *edgeBucketsSize);
+
+// Route edges to edge buckets
+ITCM_CODE static inline void routeEdgesToEdgeBuckets(const uint32_t *edgesBitmap, const size_t startingGroupIndex, const size_t endingGroupIndex, const uint32_t *edgesNode, const int divideByNodesBitmapPartSizeShiftRight, uint64_t *edgeBuckets, size_t *edgeBucketsOffset);
+
+// Enable nodes in nodes bitmap part using edge bucket
+ITCM_CODE static inline void enableNodesInNodesBitmapPartUsingEdgeBucket(const uint64_t *edgeBucket, const size_t startingEntryIndex, const size_t endingEntryIndex, const int moduloByNodesBitmapPartSizeBitsAnd, volatile uint16_t *nodesBitmapPart, const bool atomic);
+
+// Disable edges without pairs in edges bitmap using edge bucket
+ITCM_CODE static inline size_t disableEdgesWithoutPairsInEdgesBitmapUsingEdgeBucket(const uint64_t *edgeBucket, const size_t startingEntryIndex, const size_t endingEntryIndex, const int moduloByNodesBitmapPartSizeBitsAnd, const volatile uint16_t *nodesBitmapPart, uint32_t *edgesBitmap, const bool atomic);
+
+// Load edges into compact edge list
+ITCM_CODE static inline bool loadEdgesIntoCompactEdgeList(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, EdgesBitmapPipeline &edgesBitmapPipeline, const size_t edgesBitmapPartSize, CompactEdgeList &compactEdgeList);
 
 // Search remaining edges
-ITCM_CODE static inline bool searchRemainingEdges(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, fstream &edgesBitmapFile, uint32_t solution[SOLUTION_SIZE]);
+ITCM_CODE static inline bool searchRemainingEdges(const CompactEdge *edges, const size_t numberOfRemainingEdges, uint32_t solutions[MAX_NUMBER_OF_SOLUTIONS][SOLUTION_SIZE], size_t &numberOfSolutions, bool &cancelled);
 
 
 // Main function
-ITCM_CODE int main() {
+ITCM_CODE int main([[maybe_unused]] int argc, [[maybe_unused]] char *argv[]) {
 
 	// Check if configuring bottom screen for console failed
 	console = consoleDemoInit();
@@ -328,6 +543,24 @@ ITCM_CODE int main() {
 	// Display model
 	displayModel();
 	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Check if parsing command line arguments failed
+		if(!parseCommandLineArguments(argc, argv)) {
+		
+			// Return failure
+			return EXIT_FAILURE;
+		}
+		
+		// Check if replaying a trimmed graph
+		if(replayTrimmedGraphPath) {
+		
+			// Return if replaying the trimmed graph was successful
+			return replayTrimmedGraph(replayTrimmedGraphPath) ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	#endif
+	
 	// Check if initializing file system failed
 	if(!fatInitDefault()) {
 	
@@ -393,6 +626,9 @@ ITCM_CODE int main() {
 			// Update seconds since no response
 			++secondsSinceNoResponse;
 			
+			// Update stratum timer seconds
+			__atomic_store_n(&stratumTimerSeconds, stratumTimerSeconds + 1, __ATOMIC_RELAXED);
+			
 			// Check if time to process response from stratum server
 			if(++secondsSinceLastProcess == PROCESS_STRATUM_SERVER_RESPONSE_INTERVAL_SECONDS) {
 			
@@ -436,7 +672,6 @@ ITCM_CODE int main() {
 					FD_ZERO(&readSocketDescriptorsSet);
 					FD_SET(*socketDescriptorUniquePointer, &readSocketDescriptorsSet);
 					int responseAvailable;
-					char response[STRATUM_SERVER_RESPONSE_BUFFER_SIZE];
 					do {
 					
 						// Check if getting if a response from stratum server is available failed
@@ -454,8 +689,10 @@ ITCM_CODE int main() {
 						// Otherwise check if a response is available from stratum server
 						else if(responseAvailable) {
 						
-							// Check if receiving response from stratum server failed
-							int responseSize = recv(*socketDescriptorUniquePointer, response, sizeof(response) - sizeof('\0'), MSG_PEEK);
+							// Check if response buffer is full or receiving response from stratum server failed
+							size_t freeSpace;
+							char *destination = stratumResponseLineBuffer.getFreeSpace(freeSpace);
+							const int responseSize = freeSpace ? recv(*socketDescriptorUniquePointer, destination, freeSpace, 0) : 0;
 							if(responseSize <= 0) {
 							
 								// Disconnect from stratum server
@@ -466,35 +703,17 @@ ITCM_CODE int main() {
 							}
 							
 							// Check if full response wasn't received
-							if(!memchr(response, '\n', responseSize)) {
-							
-								// Check if response buffer is full
-								if(responseSize == sizeof(response) - sizeof('\0')) {
-								
-									// Disconnect from stratum server
-									socketDescriptorUniquePointer.reset();
-								}
-								
-								// Break
-								break;
-							}
+							stratumResponseLineBuffer.commit(responseSize);
+							const char *response;
+							size_t size;
+							if(!stratumResponseLineBuffer.getLines(response, size)) {
 							
-							// Check if receiving response from stratum server failed
-							responseSize = recv(*socketDescriptorUniquePointer, response, sizeof(response) - sizeof('\0'), 0);
-							if(responseSize <= 0) {
-							
-								// Disconnect from stratum server
-								socketDescriptorUniquePointer.reset();
-								
 								// Break
 								break;
 							}
 							
-							// Null terminate response
-							response[responseSize] = '\0';
-							
 							// Process response
-							processStratumServerResponse(response);
+							processStratumServerResponse(response, size);
 							
 							// Reset seconds since no response
 							secondsSinceNoResponse = 0;
@@ -506,13 +725,19 @@ ITCM_CODE int main() {
 							// Disconnect from stratum server
 							socketDescriptorUniquePointer.reset();
 						}
-						
+					
 					} while(responseAvailable);
 				}
 			}
 		});
 	#endif
 	
+	// Initialize next submit request ID
+	uint32_t nextSubmitRequestId = FIRST_SUBMIT_REQUEST_ID;
+	
+	// Initialize number of displayed shares
+	uint32_t numberOfDisplayedShares = 0;
+	
 	// Loop forever
 	while(true) {
 	
@@ -540,6 +765,31 @@ ITCM_CODE int main() {
 			// Reset seconds since no response
 			secondsSinceNoResponse = 0;
 			
+			// Clear pending shares since their responses won't be received
+			stratumShareTracker.clearPendingShares();
+			
+			// Check if using Linux
+			#ifdef __linux__
+			
+				// Check if creating stratum thread wake descriptor failed
+				if(stratumThreadWakeDescriptor == -1 && (stratumThreadWakeDescriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) == -1) {
+				
+					// Display message
+					cout << endl << "Creating stratum thread failed" << flush;
+					
+					// Wait for input to exit
+					waitForInputToExit();
+				}
+				
+				// Get the height of the job that was received when connecting
+				StratumJob connectedJob;
+				const uint64_t connectedJobHeight = nextJobMailbox.peek(connectedJob) ? connectedJob.height : 0;
+				
+				// Start stratum thread that owns the socket while connected
+				__atomic_store_n(&stratumThreadConnected, true, __ATOMIC_RELAXED);
+				stratumThread = thread(runStratumThread, *socketDescriptorUniquePointer, connectedJobHeight);
+			#endif
+			
 			// Loop forever
 			uint64_t jobHeight = 0;
 			uint64_t jobId = 0;
@@ -550,6 +800,20 @@ ITCM_CODE int main() {
 				// Disable process response from stratum server timer interrupt
 				irqDisable(IRQ_TIMER(PROCESS_STRATUM_SERVER_RESPONSE_TIMER));
 				
+				// Check if using Linux
+				#ifdef __linux__
+				
+					// Check if stratum thread disconnected from stratum server
+					if(!__atomic_load_n(&stratumThreadConnected, __ATOMIC_ACQUIRE)) {
+					
+						// Wait for stratum thread to finish
+						stratumThread.join();
+						
+						// Disconnect from stratum server
+						socketDescriptorUniquePointer.reset();
+					}
+				#endif
+				
 				// Check if not connected to stratum server
 				if(!socketDescriptorUniquePointer) {
 				
@@ -560,20 +824,35 @@ ITCM_CODE int main() {
 					break;
 				}
 				
-				// Check if new next job exists
-				if(newNextJob) {
+				// Check if shares were answered since the share statistics were displayed
+				StratumShareStatistics shareStatistics;
+				stratumShareTracker.getStatistics(shareStatistics);
+				const uint32_t numberOfAnsweredShares = shareStatistics.numberOfAcceptedShares + shareStatistics.numberOfRejectedShares + shareStatistics.numberOfStaleShares;
+				if(numberOfAnsweredShares != numberOfDisplayedShares) {
 				
-					// Set new next job to false
-					newNextJob = false;
+					// Set number of displayed shares to the number of answered shares
+					numberOfDisplayedShares = numberOfAnsweredShares;
+					
+					// Display message
+					cout << endl << "Shares accepted " << shareStatistics.numberOfAcceptedShares << " rejected " << shareStatistics.numberOfRejectedShares << " stale " << shareStatistics.numberOfStaleShares << flush;
 					
+					// Display message
+					cout << endl << "Average share latency " << shareStatistics.totalLatencyMilliseconds / numberOfAnsweredShares << " ms" << flush;
+				}
+				
+				// Check if new next job exists
+				StratumJob nextJob;
+				if(nextJobMailbox.receive(nextJob)) {
+				
 					// Set job height to next job height
-					jobHeight = nextJobHeight;
+					jobHeight = nextJob.height;
+					miningJobHeight = jobHeight;
 					
 					// Set job ID to next job ID
-					jobId = nextJobId;
+					jobId = nextJob.id;
 					
 					// Set job header to next job header
-					memcpy(jobHeader, nextJobHeader, sizeof(nextJobHeader));
+					memcpy(jobHeader, nextJob.header, sizeof(nextJob.header));
 					
 					// Create random job nonce
 					jobNonce = randomNumberGenerator();
@@ -598,34 +877,71 @@ ITCM_CODE int main() {
 				// Enable process response from stratum server timer interrupt
 				irqEnable(IRQ_TIMER(PROCESS_STRATUM_SERVER_RESPONSE_TIMER));
 				
-				// Check if mining job found a solution
-				uint32_t solution[SOLUTION_SIZE];
-				if(mineJob(jobHeader, jobNonce, expansionRam, solution)) {
+				// Go through all solutions found by mining job
+				uint32_t solutions[MAX_NUMBER_OF_SOLUTIONS][SOLUTION_SIZE];
+				const size_t numberOfSolutions = mineJob(jobHeader, jobNonce, expansionRam, solutions);
+				size_t numberOfSubmittedSolutions = 0;
+				for(size_t i = 0; i < numberOfSolutions; ++i) {
 				
-					// Check if creating submit request failed
-					char submitRequest[sizeof("{\"id\":\"1\",\"jsonrpc\":\"2.0\",\"method\":\"submit\",\"params\":{\"edge_bits\":" TO_STRING(EDGE_BITS) ",\"height\":") - sizeof('\0') + sizeof("18446744073709551615") - sizeof('\0') + sizeof(",\"job_id\":") - sizeof('\0') + sizeof("18446744073709551615") - sizeof('\0') + sizeof(",\"nonce\":") - sizeof('\0') + sizeof("18446744073709551615") - sizeof('\0') + sizeof(",\"pow\":[") - sizeof('\0') + (sizeof("4294967295,") - sizeof('\0')) * SOLUTION_SIZE - sizeof(',') + sizeof("]}}\n")];
-					const int requestSize = siprintf(submitRequest, "{\"id\":\"1\",\"jsonrpc\":\"2.0\",\"method\":\"submit\",\"params\":{\"edge_bits\":" TO_STRING(EDGE_BITS) ",\"height\":%" PRIu64 ",\"job_id\":%" PRIu64 ",\"nonce\":%" PRIu64 ",\"pow\":[%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 "]}}\n", jobHeight, jobId, jobNonce, solution[0], solution[1], solution[2], solution[3], solution[4], solution[5], solution[6], solution[7], solution[8], solution[9], solution[10], solution[11], solution[12], solution[13], solution[14], solution[15], solution[16], solution[17], solution[18], solution[19], solution[20], solution[21], solution[22], solution[23], solution[24], solution[25], solution[26], solution[27], solution[28], solution[29], solution[30], solution[31], solution[32], solution[33], solution[34], solution[35], solution[36], solution[37], solution[38], solution[39], solution[40], solution[41]);
-					if(requestSize < 0) {
+					// Get solution
+					const uint32_t *solution = solutions[i];
+					
+					// Check if solution isn't valid
+					if(!verifyCuckatooSolution(jobHeader, jobNonce, solution)) {
 					
 						// Display message
-						cout << endl << "Creating submit request failed" << flush;
+						cout << endl << "Solution failed verification" << flush;
 						
-						// Wait for input to exit
-						waitForInputToExit();
+						// Continue
+						continue;
 					}
 					
+					// Create submit request with a unique request ID
+					const uint32_t requestId = nextSubmitRequestId;
+					nextSubmitRequestId = (nextSubmitRequestId == UINT32_MAX) ? FIRST_SUBMIT_REQUEST_ID : nextSubmitRequestId + 1;
+					char submitRequest[SUBMIT_REQUEST_SIZE];
+					const size_t requestSize = writeStratumSubmitRequest(submitRequest, requestId, jobHeight, jobId, jobNonce, solution);
+					
 					// Disable process response from stratum server timer interrupt
 					irqDisable(IRQ_TIMER(PROCESS_STRATUM_SERVER_RESPONSE_TIMER));
 					
 					// Check if connected to stratum server
 					if(socketDescriptorUniquePointer) {
 					
-						// Check if sending submit request to stratum server failed
-						if(!sendFull(*socketDescriptorUniquePointer, submitRequest, requestSize)) {
+						// Check if using Linux
+						#ifdef __linux__
 						
-							// Disconnect from stratum server
-							socketDescriptorUniquePointer.reset();
-						}
+							// Check if giving submit request to the stratum thread failed
+							const uint64_t wake = 1;
+							if(!stratumSubmissionQueue.push(requestId, jobHeight, submitRequest, requestSize) || write(stratumThreadWakeDescriptor, &wake, sizeof(wake)) != sizeof(wake)) {
+							
+								// Display message
+								cout << endl << "Submitting solution failed" << flush;
+							}
+							
+							// Otherwise check if stratum thread disconnected from stratum server
+							else if(!__atomic_load_n(&stratumThreadConnected, __ATOMIC_ACQUIRE)) {
+							
+								// Display message
+								cout << endl << "Solution found. It will be submitted after reconnecting" << flush;
+								
+								// Increment number of submitted solutions
+								++numberOfSubmittedSolutions;
+							}
+						
+						// Otherwise
+						#else
+						
+							// Add share to the pending shares
+							stratumShareTracker.addPendingShare(requestId, getStratumTimeMilliseconds());
+							
+							// Check if sending submit request to stratum server failed
+							if(!sendFull(*socketDescriptorUniquePointer, submitRequest, requestSize)) {
+							
+								// Disconnect from stratum server
+								socketDescriptorUniquePointer.reset();
+							}
+						#endif
 						
 						// Otherwise
 						else {
@@ -633,8 +949,8 @@ ITCM_CODE int main() {
 							// Display message
 							cout << endl << "Solution found!!!" << flush;
 							
-							// Continue
-							continue;
+							// Increment number of submitted solutions
+							++numberOfSubmittedSolutions;
 						}
 					}
 					
@@ -642,6 +958,13 @@ ITCM_CODE int main() {
 					irqEnable(IRQ_TIMER(PROCESS_STRATUM_SERVER_RESPONSE_TIMER));
 				}
 				
+				// Check if a solution was submitted or mining job was cancelled
+				if(numberOfSubmittedSolutions || isMiningJobCancelled()) {
+				
+					// Continue
+					continue;
+				}
+				
 				// Display message
 				cout << endl << "No solution found" << flush;
 			}
@@ -655,90 +978,362 @@ ITCM_CODE int main() {
 
 // Supporting function implementation
 
-// Wait for input to exit
-void waitForInputToExit() {
-
-	// Display message
-	cout << endl << "Press A to exit" << flush;
-	
-	// Loop forever
-	while(true) {
-	
-		// Check if A is pressed
-		scanKeys();
-		if(keysDown() & KEY_A) {
-		
-			// Exit failure
-			exit(EXIT_FAILURE);
-		}
-		
-		// Wait for vertical blank
-		swiWaitForVBlank();
-	}
-}
-
-// Display mode
-void displayModel() {
+// Check if using Linux
+#ifdef __linux__
 
-	// Check if not using Linux
-	#ifndef __linux__
+	// Parse command line arguments
+	bool parseCommandLineArguments(const int argc, char *argv[]) {
 	
-		// Configure top screen for 3D
-		videoSetMode(MODE_0_3D);
-		
-		// Initialize graphics
-		glInit();
-		
-		// Set viewport
-		glViewport(0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1);
-		
-		// Enable antialiasing
-		glEnable(GL_ANTIALIAS);
+		// Set number of trimming threads to the number of CPU cores
+		unsigned long numberOfTrimmingThreads = max(thread::hardware_concurrency(), 1U);
 		
-		// Enable textures
-		glEnable(GL_TEXTURE_2D);
-		
-		// Configure rear plane
-		glClearPolyID(0);
-		glClearColor(4, 4, 4, 31);
-		glClearDepth(GL_MAX_DEPTH);
-		
-		// Map VRAM banks for texture
-		vramSetBankA(VRAM_A_TEXTURE);
-		vramSetBankB(VRAM_B_TEXTURE);
-		
-		// Check if creating texture failed
-		static int textureDescriptor;
-		if(!glGenTextures(1, &textureDescriptor)) {
+		// Go through all command line arguments
+		for(int i = 1; i < argc; ++i) {
 		
-			// Display message
-			cout << endl << "Creating texture failed" << flush;
+			// Check if argument is trimming threads
+			if(!strcmp(argv[i], "--trimming_threads") && i + 1 < argc) {
 			
-			// Wait for input to exit
-			waitForInputToExit();
-		}
-		
-		// Automatically free texture when done
-		static const unique_ptr<int, void(*)(int *)> textureDescriptorUniquePointer(&textureDescriptor, [] ITCM_CODE (int *textureDescriptorPointer) {
-		
-			// Delete texture
-			glDeleteTextures(1, textureDescriptorPointer);
-		});
-		
-		// Check if initializing NitroFS failed
-		if(!nitroFSInit(nullptr)) {
-		
-			// Display message
-			cout << endl << "Initializing NitroFS failed" << flush;
+				// Check if getting number of trimming threads failed
+				char *end;
+				errno = 0;
+				numberOfTrimmingThreads = strtoul(argv[++i], &end, 10);
+				if(!isdigit(argv[i][0]) || *end || errno || !numberOfTrimmingThreads || numberOfTrimmingThreads > MAX_NUMBER_OF_TRIMMING_THREADS) {
+				
+					// Display message
+					cout << endl << "Trimming threads is invalid" << flush;
+					
+					// Return false
+					return false;
+				}
+			}
 			
-			// Wait for input to exit
-			waitForInputToExit();
-		}
-		
-		// Check if opening model texture file failed
-		ifstream modelTextureFile("nitro:/model_texture.bin", ifstream::binary);
-		if(!modelTextureFile) {
-		
+			// Otherwise check if argument is edges bitmap storage
+			else if(!strcmp(argv[i], "--edges_bitmap_storage") && i + 1 < argc) {
+			
+				// Check if edges bitmap storage is stream
+				if(!strcmp(argv[++i], "stream")) {
+				
+					// Set edges bitmap storage type to stream
+					edgesBitmapStorageType = EdgesBitmapStorageType::STREAM;
+				}
+				
+				// Otherwise check if edges bitmap storage is positional
+				else if(!strcmp(argv[i], "pread")) {
+				
+					// Set edges bitmap storage type to positional
+					edgesBitmapStorageType = EdgesBitmapStorageType::POSITIONAL;
+				}
+				
+				// Otherwise check if edges bitmap storage is memory mapped
+				else if(!strcmp(argv[i], "mmap")) {
+				
+					// Set edges bitmap storage type to memory mapped
+					edgesBitmapStorageType = EdgesBitmapStorageType::MEMORY_MAPPED;
+				}
+				
+				// Otherwise check if edges bitmap storage is direct
+				else if(!strcmp(argv[i], "direct")) {
+				
+					// Set edges bitmap storage type to direct
+					edgesBitmapStorageType = EdgesBitmapStorageType::DIRECT;
+				}
+				
+				// Otherwise check if edges bitmap storage is io_uring
+				else if(!strcmp(argv[i], "io_uring")) {
+				
+					// Set edges bitmap storage type to io_uring
+					edgesBitmapStorageType = EdgesBitmapStorageType::IO_URING;
+				}
+				
+				// Otherwise
+				else {
+				
+					// Display message
+					cout << endl << "Edges bitmap storage is invalid" << flush;
+					
+					// Return false
+					return false;
+				}
+				
+				// Set prefer edges bitmap in memory to false
+				preferEdgesBitmapInMemory = false;
+			}
+			
+			// Otherwise check if argument is compact edge list threshold
+			else if(!strcmp(argv[i], "--compact_edge_list_threshold") && i + 1 < argc) {
+			
+				// Check if getting compact edge list threshold failed
+				char *end;
+				errno = 0;
+				const unsigned long long threshold = strtoull(argv[++i], &end, 10);
+				if(!isdigit(argv[i][0]) || *end || errno || threshold > NUMBER_OF_EDGES) {
+				
+					// Display message
+					cout << endl << "Compact edge list threshold is invalid" << flush;
+					
+					// Return false
+					return false;
+				}
+				
+				// Set compact edge list threshold
+				compactEdgeListThreshold = threshold;
+			}
+			
+			// Otherwise check if argument is trimming target
+			else if(!strcmp(argv[i], "--trimming_target") && i + 1 < argc) {
+			
+				// Check if getting trimming target number of edges failed
+				char *end;
+				errno = 0;
+				const unsigned long long target = strtoull(argv[++i], &end, 10);
+				if(!isdigit(argv[i][0]) || *end || errno || target > NUMBER_OF_EDGES) {
+				
+					// Display message
+					cout << endl << "Trimming target is invalid" << flush;
+					
+					// Return false
+					return false;
+				}
+				
+				// Set trimming target number of edges
+				trimmingTargetNumberOfEdges = target;
+			}
+			
+			// Otherwise check if argument is trimmer
+			else if(!strcmp(argv[i], "--trimmer") && i + 1 < argc) {
+			
+				// Check if trimmer is lean
+				if(!strcmp(argv[++i], "lean")) {
+				
+					// Set trimmer type to lean
+					trimmerType = TrimmerType::LEAN;
+				}
+				
+				// Otherwise check if trimmer is mean
+				else if(!strcmp(argv[i], "mean")) {
+				
+					// Set trimmer type to mean
+					trimmerType = TrimmerType::MEAN;
+				}
+				
+				// Otherwise
+				else {
+				
+					// Display message
+					cout << endl << "Trimmer is invalid" << flush;
+					
+					// Return false
+					return false;
+				}
+			}
+			
+			// Otherwise check if argument is max nodes bitmap part size
+			else if(!strcmp(argv[i], "--max_nodes_bitmap_part_size") && i + 1 < argc) {
+			
+				// Check if getting max nodes bitmap part size failed
+				char *end;
+				errno = 0;
+				const unsigned long long size = strtoull(argv[++i], &end, 10);
+				if(!isdigit(argv[i][0]) || *end || errno || size < sizeof(uint64_t) || size > BYTES_PER_BITMAP || !has_single_bit(size)) {
+				
+					// Display message
+					cout << endl << "Max nodes bitmap part size is invalid" << flush;
+					
+					// Return false
+					return false;
+				}
+				
+				// Set max nodes bitmap part size
+				maxNodesBitmapPartSize = size;
+			}
+			
+			// Otherwise check if argument is dump trimmed graph
+			else if(!strcmp(argv[i], "--dump_trimmed_graph") && i + 1 < argc) {
+			
+				// Set dump trimmed graph directory
+				dumpTrimmedGraphDirectory = argv[++i];
+			}
+			
+			// Otherwise check if argument is dump trimmed graph nodes
+			else if(!strcmp(argv[i], "--dump_trimmed_graph_nodes")) {
+			
+				// Set dump trimmed graph nodes to true
+				dumpTrimmedGraphNodes = true;
+			}
+			
+			// Otherwise check if argument is replay trimmed graph
+			else if(!strcmp(argv[i], "--replay_trimmed_graph") && i + 1 < argc) {
+			
+				// Set replay trimmed graph path
+				replayTrimmedGraphPath = argv[++i];
+			}
+			
+			// Otherwise
+			else {
+			
+				// Display message
+				cout << endl << "Usage: " << argv[0] << " [--trimming_threads number] [--edges_bitmap_storage stream|pread|mmap|direct|io_uring] [--trimmer lean|mean] [--compact_edge_list_threshold number] [--trimming_target number] [--max_nodes_bitmap_part_size bytes] [--dump_trimmed_graph directory] [--dump_trimmed_graph_nodes] [--replay_trimmed_graph file]" << flush;
+				
+				// Return false
+				return false;
+			}
+		}
+		
+		// Create trimming threads
+		trimmingThreads = make_unique<ThreadPool>(numberOfTrimmingThreads);
+		
+		// Return true
+		return true;
+	}
+	
+	// Replay trimmed graph
+	bool replayTrimmedGraph(const char *path) {
+	
+		// Check if loading trimmed graph failed
+		static CompactEdgeList compactEdgeList;
+		TrimmedGraphHeader header;
+		if(!loadTrimmedGraph(path, header, compactEdgeList)) {
+		
+			// Display message
+			cout << endl << "Reading trimmed graph failed" << flush;
+			
+			// Return false
+			return false;
+		}
+		
+		// Display message
+		cout << endl << "Replaying trimmed graph with " << header.numberOfEdges << " edges after " << header.numberOfTrimmingRounds << " trimming rounds" << flush;
+		
+		// Check if searching remaining edges failed
+		const chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+		uint32_t solutions[MAX_NUMBER_OF_SOLUTIONS][SOLUTION_SIZE];
+		size_t numberOfSolutions = 0;
+		bool cancelled;
+		if(!searchRemainingEdges(compactEdgeList.getEdges(), compactEdgeList.getNumberOfEdges(), solutions, numberOfSolutions, cancelled)) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Display message
+		cout << endl << "Searching took " << chrono::duration<double>(chrono::steady_clock::now() - startTime).count() << " seconds" << flush;
+		
+		// Go through all solutions
+		for(size_t i = 0; i < numberOfSolutions; ++i) {
+		
+			// Display message
+			cout << endl << (verifyCuckatooSolution(header.jobHeader, header.jobNonce, solutions[i]) ? "Solution found:" : "Invalid solution found:");
+			
+			// Go through all of the solution's edges
+			for(int j = 0; j < SOLUTION_SIZE; ++j) {
+			
+				// Display edge's index
+				cout << ' ' << solutions[i][j];
+			}
+			
+			// Flush display
+			cout << flush;
+		}
+		
+		// Check if no solutions were found
+		if(!numberOfSolutions) {
+		
+			// Display message
+			cout << endl << "No solution found" << flush;
+		}
+		
+		// Display message
+		cout << endl << flush;
+		
+		// Return true
+		return true;
+	}
+#endif
+
+// Wait for input to exit
+void waitForInputToExit() {
+
+	// Display message
+	cout << endl << "Press A to exit" << flush;
+	
+	// Loop forever
+	while(true) {
+	
+		// Check if A is pressed
+		scanKeys();
+		if(keysDown() & KEY_A) {
+		
+			// Exit failure
+			exit(EXIT_FAILURE);
+		}
+		
+		// Wait for vertical blank
+		swiWaitForVBlank();
+	}
+}
+
+// Display mode
+void displayModel() {
+
+	// Check if not using Linux
+	#ifndef __linux__
+	
+		// Configure top screen for 3D
+		videoSetMode(MODE_0_3D);
+		
+		// Initialize graphics
+		glInit();
+		
+		// Set viewport
+		glViewport(0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1);
+		
+		// Enable antialiasing
+		glEnable(GL_ANTIALIAS);
+		
+		// Enable textures
+		glEnable(GL_TEXTURE_2D);
+		
+		// Configure rear plane
+		glClearPolyID(0);
+		glClearColor(4, 4, 4, 31);
+		glClearDepth(GL_MAX_DEPTH);
+		
+		// Map VRAM banks for texture
+		vramSetBankA(VRAM_A_TEXTURE);
+		vramSetBankB(VRAM_B_TEXTURE);
+		
+		// Check if creating texture failed
+		static int textureDescriptor;
+		if(!glGenTextures(1, &textureDescriptor)) {
+		
+			// Display message
+			cout << endl << "Creating texture failed" << flush;
+			
+			// Wait for input to exit
+			waitForInputToExit();
+		}
+		
+		// Automatically free texture when done
+		static const unique_ptr<int, void(*)(int *)> textureDescriptorUniquePointer(&textureDescriptor, [] ITCM_CODE (int *textureDescriptorPointer) {
+		
+			// Delete texture
+			glDeleteTextures(1, textureDescriptorPointer);
+		});
+		
+		// Check if initializing NitroFS failed
+		if(!nitroFSInit(nullptr)) {
+		
+			// Display message
+			cout << endl << "Initializing NitroFS failed" << flush;
+			
+			// Wait for input to exit
+			waitForInputToExit();
+		}
+		
+		// Check if opening model texture file failed
+		ifstream modelTextureFile("nitro:/model_texture.bin", ifstream::binary);
+		if(!modelTextureFile) {
+		
 			// Display message
 			cout << endl << "Opening model texture file failed" << flush;
 			
@@ -1133,7 +1728,7 @@ unique_ptr<int, void(*)(int *)> connectToStratumServer() {
 				waitForInputToExit();
 			}
 		}
-		
+	
 	} while(socketDescriptor == -1);
 	
 	// Check if connecting to stratum server failed
@@ -1163,6 +1758,9 @@ unique_ptr<int, void(*)(int *)> connectToStratumServer() {
 	// Display message
 	cout << endl << "Connected to stratum server" << flush;
 	
+	// Clear stratum response line buffer
+	stratumResponseLineBuffer.clear();
+	
 	// Check if stratum server username exists
 	if(stratumUsername[0]) {
 	
@@ -1197,8 +1795,9 @@ unique_ptr<int, void(*)(int *)> connectToStratumServer() {
 	}
 	
 	// Check if receiving response from stratum server failed
-	char response[STRATUM_SERVER_RESPONSE_BUFFER_SIZE];
-	if(!receiveFull(socketDescriptor, response, sizeof(response))) {
+	const char *response;
+	size_t responseSize;
+	if(!receiveFull(socketDescriptor, response, responseSize)) {
 	
 		// Shutdown socket
 		shutdown(socketDescriptor, SHUT_RDWR);
@@ -1216,8 +1815,21 @@ unique_ptr<int, void(*)(int *)> connectToStratumServer() {
 		return unique_ptr<int, void(*)(int *)>(nullptr, [] ITCM_CODE (int *) {});
 	}
 	
+	// Go through all lines of the response
+	bool loggedIn = false;
+	for(const char *lineStart = response, *lineEnd = static_cast<const char *>(memchr(lineStart, '\n', responseSize)); lineEnd; lineStart = &lineEnd[sizeof('\n')], lineEnd = static_cast<const char *>(memchr(lineStart, '\n', &response[responseSize] - lineStart))) {
+	
+		// Check if line is a successful response
+		StratumMessage message;
+		if(parseStratumMessage(lineStart, lineEnd - lineStart, message) && message.errorIsNull) {
+		
+			// Set logged in to true
+			loggedIn = true;
+		}
+	}
+	
 	// Check if logging into stratum server failed
-	if(!strstr(response, "\"error\":null")) {
+	if(!loggedIn) {
 	
 		// Shutdown socket
 		shutdown(socketDescriptor, SHUT_RDWR);
@@ -1258,7 +1870,7 @@ unique_ptr<int, void(*)(int *)> connectToStratumServer() {
 	}
 	
 	// Check if receiving response from stratum server failed
-	if(!receiveFull(socketDescriptor, response, sizeof(response))) {
+	if(!receiveFull(socketDescriptor, response, responseSize)) {
 	
 		// Shutdown socket
 		shutdown(socketDescriptor, SHUT_RDWR);
@@ -1277,7 +1889,7 @@ unique_ptr<int, void(*)(int *)> connectToStratumServer() {
 	}
 	
 	// Check if getting job from response failed
-	if(!processStratumServerResponse(response)) {
+	if(!processStratumServerResponse(response, responseSize)) {
 	
 		// Shutdown socket
 		shutdown(socketDescriptor, SHUT_RDWR);
@@ -1307,91 +1919,45 @@ unique_ptr<int, void(*)(int *)> connectToStratumServer() {
 }
 
 // Process stratum server response
-bool processStratumServerResponse(char response[STRATUM_SERVER_RESPONSE_BUFFER_SIZE]) {
+bool processStratumServerResponse(const char *response, const size_t size) {
 
-	// Initialize job height
-	unsigned long long jobHeight;
-	
-	// Initialize job ID
-	unsigned long long jobId;
-	
-	// Initialize job header
-	uint8_t jobHeader[HEADER_SIZE];
+	// Initialize job
+	StratumJob job;
 	
 	// Set job found to false
 	bool jobFound = false;
 	
-	// Go through all complete parts of the response
-	for(char *partStart = response, *partEnd = strchr(partStart, '\n'); partStart && partEnd; partStart = &partEnd[sizeof('\n')], partEnd = strchr(partStart, '\n')) {
+	// Go through all complete lines of the response
+	for(const char *lineStart = response, *lineEnd = static_cast<const char *>(memchr(lineStart, '\n', size)); lineEnd; lineStart = &lineEnd[sizeof('\n')], lineEnd = static_cast<const char *>(memchr(lineStart, '\n', &response[size] - lineStart))) {
 	
-		// Null terminate the part
-		*partEnd = '\0';
+		// Check if parsing line failed
+		StratumMessage message;
+		if(!parseStratumMessage(lineStart, lineEnd - lineStart, message)) {
+		
+			// Continue
+			continue;
+		}
+		
+		// Check if line is a response to a submit request
+		if((message.method == StratumMethod::SUBMIT || message.method == StratumMethod::NONE) && message.hasId && message.id >= FIRST_SUBMIT_REQUEST_ID) {
 		
-		// Check if getting part's method was successful
-		const char *method = strstr(partStart, "\"method\":");
-		if(method) {
+			// Resolve the share with the response's result
+			stratumShareTracker.resolvePendingShare(message.id, message.errorIsNull ? StratumShareResult::ACCEPTED : ((message.hasErrorCode && message.errorCode == STALE_SHARE_ERROR_CODE) ? StratumShareResult::STALE : StratumShareResult::REJECTED), getStratumTimeMilliseconds());
+		}
+		
+		// Otherwise check if line's method is get job template or job
+		else if(message.method == StratumMethod::GET_JOB_TEMPLATE || message.method == StratumMethod::JOB) {
 		
-			// Check if method is get job template or job
-			if(!strncmp(&method[sizeof("\"method\":") - sizeof('\0')], "\"getjobtemplate\"", sizeof("\"getjobtemplate\"") - sizeof('\0')) || !strncmp(&method[sizeof("\"method\":") - sizeof('\0')], "\"job\"", sizeof("\"job\"") - sizeof('\0'))) {
+			// Set job found to if the line has a successful job with a valid height, ID, and header
+			jobFound = (message.errorIsNull || message.method == StratumMethod::JOB) && message.hasHeight && message.height && message.hasJobId && message.hasHeader;
 			
-				// Set job found to false
-				jobFound = false;
-				
-				// Check if getting job was successful
-				if(strstr(partStart, "\"error\":null") || !strncmp(&method[sizeof("\"method\":") - sizeof('\0')], "\"job\"", sizeof("\"job\"") - sizeof('\0'))) {
-				
-					// Check if getting job height was successful
-					const char *height = strstr(partStart, "\"height\":");
-					if(height) {
-					
-						// Check if getting job height was successful
-						char *end;
-						errno = 0;
-						jobHeight = strtoull(&height[sizeof("\"height\":") - sizeof('\0')], &end, 10);
-						if(end != &height[sizeof("\"height\":") - sizeof('\0')] && isdigit(height[sizeof("\"height\":") - sizeof('\0')]) && (height[sizeof("\"height\":") - sizeof('\0')] != '0' || !isdigit(height[sizeof("\"height\":") - sizeof('\0') + sizeof('0')])) && !errno && jobHeight && jobHeight <= UINT64_MAX) {
-						
-							// Check if getting job ID was successful
-							const char *id = strstr(partStart, "\"job_id\":");
-							if(id) {
-							
-								// Check if getting job ID was successful
-								errno = 0;
-								jobId = strtoull(&id[sizeof("\"job_id\":") - sizeof('\0')], &end, 10);
-								if(end != &id[sizeof("\"job_id\":") - sizeof('\0')] && isdigit(id[sizeof("\"job_id\":") - sizeof('\0')]) && (id[sizeof("\"job_id\":") - sizeof('\0')] != '0' || !isdigit(id[sizeof("\"job_id\":") - sizeof('\0') + sizeof('0')])) && !errno && jobId <= UINT64_MAX) {
-								
-									// Check if getting job pre-proof of work was successful
-									const char *preProofOfWork = strstr(partStart, "\"pre_pow\":\"");
-									if(preProofOfWork) {
-									
-										// Reset job header
-										memset(jobHeader, 0, sizeof(jobHeader));
-										
-										// Go through all hex characters in the job pre-proof of work
-										for(const char *i = &preProofOfWork[sizeof("\"pre_pow\":\"") - sizeof('\0')]; isxdigit(*i) && !isupper(*i); ++i) {
-										
-											// Check if job pre-proof of work is too long
-											if((i - &preProofOfWork[sizeof("\"pre_pow\":\"") - sizeof('\0')]) / 2 == sizeof(jobHeader)) {
-											
-												// Break
-												break;
-											}
-											
-											// Set character in job header
-											jobHeader[(i - &preProofOfWork[sizeof("\"pre_pow\":\"") - sizeof('\0')]) / 2] |= ((i - &preProofOfWork[sizeof("\"pre_pow\":\"") - sizeof('\0')]) % 2) ? ((*i - ((*i > '9') ? '0' + 'a' - '9' - 1 : '0')) & 0xF) : ((*i - ((*i > '9') ? '0' + 'a' - '9' - 1 : '0')) << 4);
-											
-											// Check if next character terminates the job pre-proof of work and the job pre-proof of work is the correct size
-											if(i[1] == '"' && i - &preProofOfWork[sizeof("\"pre_pow\":\"") - sizeof('\0')] == sizeof(jobHeader) * 2 - 1) {
-											
-												// Set job found to true
-												jobFound = true;
-											}
-										}
-									}
-								}
-							}
-						}
-					}
-				}
+			// Check if job was found
+			if(jobFound) {
+			
+				// Set job
+				job.height = message.height;
+				job.id = message.jobId;
+				memcpy(job.header, message.header, sizeof(message.header));
 			}
 		}
 	}
@@ -1399,17 +1965,8 @@ bool processStratumServerResponse(char response[STRATUM_SERVER_RESPONSE_BUFFER_S
 	// Check if a job was found
 	if(jobFound) {
 	
-		// Set next job height to job height
-		nextJobHeight = jobHeight;
-		
-		// Set next job ID to job ID
-		nextJobId = jobId;
-		
-		// Set next job header to job header
-		memcpy(nextJobHeader, jobHeader, sizeof(jobHeader));
-		
-		// Set new next job to true
-		newNextJob = true;
+		// Publish job as the next job
+		nextJobMailbox.publish(job);
 		
 		// Return true
 		return true;
@@ -1419,13 +1976,210 @@ bool processStratumServerResponse(char response[STRATUM_SERVER_RESPONSE_BUFFER_S
 	return false;
 }
 
-// Send full
-bool sendFull(const int socketDescriptor, const char *data, size_t size) {
+// Check if using Linux
+#ifdef __linux__
 
-	// Check if setting socket as non-blocking failed
-	int nonBlocking = 1;
-	if(ioctl(socketDescriptor, FIONBIO, &nonBlocking)) {
-	
+	// Run stratum thread
+	void runStratumThread(const int socketDescriptor, const uint64_t jobHeight) {
+	
+		// Get number of submit requests queued for a previous connection
+		size_t numberOfPreviousSubmitRequests = stratumSubmissionQueue.getSize();
+		
+		// Loop while connected to stratum server
+		pollfd descriptors[] = {{socketDescriptor, POLLIN, 0}, {stratumThreadWakeDescriptor, POLLIN, 0}};
+		chrono::steady_clock::time_point lastResponseTime = chrono::steady_clock::now();
+		chrono::steady_clock::time_point nextKeepaliveTime = lastResponseTime + chrono::seconds(PROCESS_STRATUM_SERVER_RESPONSE_INTERVAL_SECONDS);
+		while(true) {
+		
+			// Go through all queued submit requests
+			bool sendingFailed = false;
+			uint32_t submitRequestId;
+			uint64_t submitRequestHeight;
+			char submitRequest[SUBMIT_REQUEST_SIZE];
+			size_t submitRequestSize;
+			while(stratumSubmissionQueue.peek(submitRequestId, submitRequestHeight, submitRequest, submitRequestSize)) {
+			
+				// Check if submit request was queued for a previous connection
+				const bool isPreviousSubmitRequest = numberOfPreviousSubmitRequests;
+				if(isPreviousSubmitRequest) {
+				
+					// Decrement number of previous submit requests
+					--numberOfPreviousSubmitRequests;
+				}
+				
+				// Check if submit request was queued for a previous connection and its job's height isn't the current job's height
+				if(isPreviousSubmitRequest && submitRequestHeight != jobHeight) {
+				
+					// Discard submit request
+					stratumSubmissionQueue.pop();
+					
+					// Continue
+					continue;
+				}
+				
+				// Add share to the pending shares
+				stratumShareTracker.addPendingShare(submitRequestId, getStratumTimeMilliseconds());
+				
+				// Check if sending submit request to stratum server failed
+				if(!sendFull(socketDescriptor, submitRequest, submitRequestSize)) {
+				
+					// Set sending failed to true
+					sendingFailed = true;
+					
+					// Break
+					break;
+				}
+				
+				// Remove submit request now that it was sent
+				stratumSubmissionQueue.pop();
+			}
+			
+			// Check if sending failed
+			if(sendingFailed) {
+			
+				// Break
+				break;
+			}
+			
+			// Check if time to send a keepalive request to stratum server
+			chrono::steady_clock::time_point currentTime = chrono::steady_clock::now();
+			if(currentTime >= nextKeepaliveTime) {
+			
+				// Check if sending keepalive request to stratum server failed
+				if(!sendFull(socketDescriptor, "{\"id\":\"1\",\"jsonrpc\":\"2.0\",\"method\":\"keepalive\",\"params\":null}\n", sizeof("{\"id\":\"1\",\"jsonrpc\":\"2.0\",\"method\":\"keepalive\",\"params\":null}\n") - sizeof('\0'))) {
+				
+					// Break
+					break;
+				}
+				
+				// Update next keepalive time
+				nextKeepaliveTime = currentTime + chrono::seconds(PROCESS_STRATUM_SERVER_RESPONSE_INTERVAL_SECONDS);
+			}
+			
+			// Check if no response has been received from stratum server for awhile
+			if(currentTime - lastResponseTime >= chrono::seconds(NO_STRATUM_SERVER_RESPONSE_DISCONNECT_SECONDS)) {
+			
+				// Break
+				break;
+			}
+			
+			// Check if waiting for a response from stratum server, a submit request, or the next keepalive failed
+			const int result = poll(descriptors, sizeof(descriptors) / sizeof(descriptors[0]), chrono::ceil<chrono::milliseconds>(min(nextKeepaliveTime, lastResponseTime + chrono::seconds(NO_STRATUM_SERVER_RESPONSE_DISCONNECT_SECONDS)) - currentTime).count());
+			if(result == -1 && errno != EINTR) {
+			
+				// Break
+				break;
+			}
+			
+			// Check if woken up to send a submit request
+			if(result > 0 && descriptors[1].revents) {
+			
+				// Check if clearing wake failed
+				uint64_t wake;
+				if(read(stratumThreadWakeDescriptor, &wake, sizeof(wake)) == -1 && errno != EAGAIN) {
+				
+					// Break
+					break;
+				}
+			}
+			
+			// Check if a response from stratum server is available
+			if(result > 0 && descriptors[0].revents) {
+			
+				// Check if response buffer is full or receiving response from stratum server failed
+				size_t freeSpace;
+				char *destination = stratumResponseLineBuffer.getFreeSpace(freeSpace);
+				const ssize_t received = freeSpace ? recv(socketDescriptor, destination, freeSpace, 0) : 0;
+				if(received <= 0) {
+				
+					// Break
+					break;
+				}
+				
+				// Check if full response was received
+				stratumResponseLineBuffer.commit(received);
+				const char *response;
+				size_t responseSize;
+				if(stratumResponseLineBuffer.getLines(response, responseSize)) {
+				
+					// Process response
+					processStratumServerResponse(response, responseSize);
+					
+					// Update last response time
+					lastResponseTime = chrono::steady_clock::now();
+				}
+			}
+		}
+		
+		// Set that stratum thread disconnected from stratum server
+		__atomic_store_n(&stratumThreadConnected, false, __ATOMIC_RELEASE);
+	}
+#endif
+
+// Get stratum time milliseconds
+uint32_t getStratumTimeMilliseconds() {
+
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Return steady clock time in milliseconds
+		return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+	
+	// Otherwise
+	#else
+	
+		// Return stratum timer seconds in milliseconds
+		return __atomic_load_n(&stratumTimerSeconds, __ATOMIC_RELAXED) * MILLISECONDS_IN_A_SECOND;
+	#endif
+}
+
+// Wait for socket
+bool waitForSocket(const int socketDescriptor, const bool sending, const long timeoutMilliseconds) {
+
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Check if waiting for the socket to be ready failed not because it was interrupted
+		pollfd descriptor = {socketDescriptor, static_cast<short>(sending ? POLLOUT : POLLIN), 0};
+		if(poll(&descriptor, 1, max(timeoutMilliseconds, 0L)) == -1 && errno != EINTR) {
+		
+			// Return false
+			return false;
+		}
+	
+	// Otherwise
+	#else
+	
+		// Check if waiting for the socket to be ready failed
+		fd_set socketDescriptorsSet;
+		FD_ZERO(&socketDescriptorsSet);
+		FD_SET(socketDescriptor, &socketDescriptorsSet);
+		timeval timeout = {
+		
+			// Seconds
+			.tv_sec = max(timeoutMilliseconds, 0L) / MILLISECONDS_IN_A_SECOND,
+			
+			// Microseconds
+			.tv_usec = max(timeoutMilliseconds, 0L) % MILLISECONDS_IN_A_SECOND * MICROSECONDS_IN_A_MILLISECOND
+		};
+		if(select(socketDescriptor + 1, sending ? nullptr : &socketDescriptorsSet, sending ? &socketDescriptorsSet : nullptr, nullptr, &timeout) == -1) {
+		
+			// Return false
+			return false;
+		}
+	#endif
+	
+	// Return true
+	return true;
+}
+
+// Send full
+bool sendFull(const int socketDescriptor, const char *data, size_t size) {
+
+	// Check if setting socket as non-blocking failed
+	int nonBlocking = 1;
+	if(ioctl(socketDescriptor, FIONBIO, &nonBlocking)) {
+	
 		// Return false
 		return false;
 	}
@@ -1454,8 +2208,8 @@ bool sendFull(const int socketDescriptor, const char *data, size_t size) {
 		const int sent = send(socketDescriptor, data, size, 0);
 		if(sent == -1) {
 		
-			// Check if sending failed not because it would have blocked
-			if(errno != EWOULDBLOCK) {
+			// Check if sending failed not because it would have blocked or waiting for the socket to be writable failed
+			if(errno != EWOULDBLOCK || !waitForSocket(socketDescriptor, true, SEND_TIMEOUT_MILLISECONDS - timerTicks2msec(cpuGetTiming()))) {
 			
 				// Stop CPU timing
 				cpuEndTiming();
@@ -1494,7 +2248,7 @@ bool sendFull(const int socketDescriptor, const char *data, size_t size) {
 }
 
 // Receive full
-bool receiveFull(const int socketDescriptor, char *data, const size_t size) {
+bool receiveFull(const int socketDescriptor, const char *&lines, size_t &size) {
 
 	// Check if setting socket as non-blocking failed
 	int nonBlocking = 1;
@@ -1508,8 +2262,7 @@ bool receiveFull(const int socketDescriptor, char *data, const size_t size) {
 	cpuStartTiming(SOCKET_TIMEOUT_TIMER);
 	
 	// Loop until full message is received
-	int received;
-	do {
+	while(!stratumResponseLineBuffer.getLines(lines, size)) {
 	
 		// Check if receive timeout occurred
 		if(timerTicks2msec(cpuGetTiming()) >= RECEIVE_TIMEOUT_MILLISECONDS) {
@@ -1525,9 +2278,11 @@ bool receiveFull(const int socketDescriptor, char *data, const size_t size) {
 			return false;
 		}
 		
-		// Check if receiving data failed not because it would have blocked
-		received = recv(socketDescriptor, data, size - sizeof('\0'), MSG_PEEK);
-		if((received == -1 && errno != EWOULDBLOCK) || !received || (received != -1 && static_cast<size_t>(received) == size - sizeof('\0'))) {
+		// Check if receiving data failed not because it would have blocked or the buffer is full
+		size_t freeSpace;
+		char *destination = stratumResponseLineBuffer.getFreeSpace(freeSpace);
+		const int received = freeSpace ? recv(socketDescriptor, destination, freeSpace, 0) : 0;
+		if((received == -1 && errno != EWOULDBLOCK) || !received) {
 		
 			// Stop CPU timing
 			cpuEndTiming();
@@ -1539,26 +2294,35 @@ bool receiveFull(const int socketDescriptor, char *data, const size_t size) {
 			// Return false
 			return false;
 		}
-	
-	} while(received == -1 || !memchr(data, '\n', received));
-	
-	// Stop CPU timing
-	cpuEndTiming();
-	
-	// Check if receiving data failed
-	received = recv(socketDescriptor, data, size - sizeof('\0'), 0);
-	if(received <= 0) {
-	
-		// Set socket as blocking
-		nonBlocking = 0;
-		ioctl(socketDescriptor, FIONBIO, &nonBlocking);
 		
-		// Return false
-		return false;
+		// Check if no data was received
+		if(received == -1) {
+		
+			// Check if waiting for the socket to be readable failed
+			if(!waitForSocket(socketDescriptor, false, RECEIVE_TIMEOUT_MILLISECONDS - timerTicks2msec(cpuGetTiming()))) {
+			
+				// Stop CPU timing
+				cpuEndTiming();
+				
+				// Set socket as blocking
+				nonBlocking = 0;
+				ioctl(socketDescriptor, FIONBIO, &nonBlocking);
+				
+				// Return false
+				return false;
+			}
+		}
+		
+		// Otherwise
+		else {
+		
+			// Include received data in the buffer
+			stratumResponseLineBuffer.commit(received);
+		}
 	}
 	
-	// Null terminate message
-	data[received] = '\0';
+	// Stop CPU timing
+	cpuEndTiming();
 	
 	// Check if setting socket as blocking failed
 	nonBlocking = 0;
@@ -1572,61 +2336,161 @@ bool receiveFull(const int socketDescriptor, char *data, const size_t size) {
 	return true;
 }
 
-// Mine job
-bool mineJob(const uint8_t jobHeader[HEADER_SIZE], const uint64_t jobNonce, volatile uint16_t *expansionRam, uint32_t solution[SOLUTION_SIZE]) {
+// Is memory available
+bool isMemoryAvailable(const size_t size) {
+
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Check if getting the amount of free physical memory failed
+		const long numberOfFreePages = sysconf(_SC_AVPHYS_PAGES);
+		const long pageSize = sysconf(_SC_PAGESIZE);
+		if(numberOfFreePages == -1 || pageSize == -1) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Return if the size fits in free physical memory without using its reserve
+		return static_cast<unsigned long long>(numberOfFreePages) * pageSize >= static_cast<unsigned long long>(size) + RESERVED_MEMORY_SIZE;
 	
+	// Otherwise
+	#else
+	
+		// Return true to let allocating the memory decide
+		return true;
+	#endif
+}
+
+// Is mining job cancelled
+bool isMiningJobCancelled() {
+
+	// Return if a job with a different height than the mining job was received from the stratum server
+	StratumJob nextJob;
+	return nextJobMailbox.peek(nextJob) && nextJob.height != miningJobHeight;
+}
+
+// Mine job
+size_t mineJob(const uint8_t jobHeader[HEADER_SIZE], const uint64_t jobNonce, volatile uint16_t *expansionRam, uint32_t solutions[MAX_NUMBER_OF_SOLUTIONS][SOLUTION_SIZE]) {
+
 	// Get SipHash keys from job header and nonce
 	uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys;
 	blake2b(jobHeader, jobNonce, sipHashKeys);
 	
-	// Check if creating edges bitmap file failed
-	fstream edgesBitmapFile(EDGES_BITMAP_FILE, fstream::in | fstream::out | fstream::binary | fstream::trunc);
-	if(!edgesBitmapFile) {
+	// Keep the edges bitmap in memory if it's preferred and enough memory is available
+	static const unique_ptr<uint32_t[]> edgesBitmap((preferEdgesBitmapInMemory && isMemoryAvailable(BYTES_PER_BITMAP)) ? new (nothrow) uint32_t[BYTES_PER_BITMAP / sizeof(uint32_t)] : nullptr);
+	
+	// Check if creating edges bitmap storage failed
+	static const unique_ptr<EdgesBitmapStorage> edgesBitmapStorage = createEdgesBitmapStorage(edgesBitmapStorageType);
+	if(!edgesBitmapStorage) {
 	
 		// Display message
-		cout << endl << "Creating " EDGES_BITMAP_FILE " failed" << flush;
+		cout << endl << "Allocating memory failed" << flush;
 		
 		// Wait for input to exit
 		waitForInputToExit();
 	}
 	
-	// Check if trimming edges failed
-	if(!trimEdges(sipHashKeys, edgesBitmapFile, expansionRam)) {
+	// Check if edges bitmap isn't in memory and creating edges bitmap file failed
+	if(!edgesBitmap && !edgesBitmapStorage->open(EDGES_BITMAP_FILE, BYTES_PER_BITMAP)) {
 	
-		// Close edges bitmap file
-		edgesBitmapFile.close();
+		// Display message
+		cout << endl << "Creating " EDGES_BITMAP_FILE " failed" << flush;
 		
 		// Wait for input to exit
 		waitForInputToExit();
 	}
 	
-	// Check if searching remaining edges failed
-	solution[1] = 0;
-	if(!searchRemainingEdges(sipHashKeys, edgesBitmapFile, solution)) {
+	// Compact edge list
+	static CompactEdgeList compactEdgeList;
+	
+	// Check if trimming edges failed
+	size_t numberOfRemainingEdges;
+	int numberOfTrimmingRounds;
+	const TrimmingResult trimmingResult = trimEdges(sipHashKeys, *edgesBitmapStorage, edgesBitmap.get(), expansionRam, compactEdgeList, numberOfRemainingEdges, numberOfTrimmingRounds);
+	if(trimmingResult == TrimmingResult::FAILED) {
 	
-		// Close edges bitmap file
-		edgesBitmapFile.close();
-		
 		// Wait for input to exit
 		waitForInputToExit();
 	}
 	
-	// Close edges bitmap file
-	edgesBitmapFile.close();
+	// Check if trimming edges was abandoned
+	if(trimmingResult == TrimmingResult::ABANDONED) {
+	
+		// Return no solutions so that the next nonce is tried
+		return 0;
+	}
+	
+	// Check if trimming edges was cancelled
+	if(trimmingResult == TrimmingResult::CANCELLED) {
+	
+		// Display message
+		cout << endl << "Job is stale" << flush;
+		
+		// Return no solutions
+		return 0;
+	}
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Check if dumping trimmed graph
+		if(dumpTrimmedGraphDirectory) {
+		
+			// Check if dumping trimmed graph to a file named after the job nonce failed
+			const string path = string(dumpTrimmedGraphDirectory) + "/trimmed_graph_" + to_string(jobNonce) + ".bin";
+			if(!dumpTrimmedGraph(path.c_str(), sipHashKeys, jobHeader, jobNonce, numberOfTrimmingRounds, compactEdgeList, dumpTrimmedGraphNodes)) {
+			
+				// Display message
+				cout << endl << "Writing trimmed graph failed" << flush;
+			}
+		}
+	#endif
+	
+	// Check if searching remaining edges failed
+	size_t numberOfSolutions = 0;
+	bool cancelled;
+	if(!searchRemainingEdges(compactEdgeList.getEdges(), numberOfRemainingEdges, solutions, numberOfSolutions, cancelled)) {
+	
+		// Return no solutions so that the next nonce is tried
+		return 0;
+	}
+	
+	// Check if searching remaining edges was cancelled
+	if(cancelled) {
+	
+		// Display message
+		cout << endl << "Job is stale" << flush;
+		
+		// Return no solutions
+		return 0;
+	}
 	
-	// Return if a solution was found
-	return solution[1];
+	// Return number of solutions
+	return numberOfSolutions;
 }
 
 // Trim edges
-bool trimEdges(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, fstream &edgesBitmapFile, volatile uint16_t *expansionRam) {
+TrimmingResult trimEdges(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, EdgesBitmapStorage &edgesBitmapStorage, uint32_t *edgesBitmap, volatile uint16_t *expansionRam, CompactEdgeList &compactEdgeList, size_t &numberOfEdges, int &numberOfTrimmingRounds) {
 
 	// Display message
 	cout << endl << "Trimming edges 0%" << flush;
 	
 	// Set nodes bitmap part to RAM expansion pak's RAM if available
 	volatile uint16_t *nodesBitmapPart = expansionRam;
-	const size_t nodesBitmapPartSize = expansionRam ? ram_size() : LOCAL_RAM_SIZE;
+	size_t nodesBitmapPartSize = expansionRam ? ram_size() : LOCAL_RAM_SIZE;
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Check if the nodes bitmap part size is limited
+		if(maxNodesBitmapPartSize) {
+		
+			// Limit nodes bitmap part size to the max nodes bitmap part size
+			nodesBitmapPartSize = min(nodesBitmapPartSize, maxNodesBitmapPartSize);
+		}
+	#endif
+	
 	const int divideByNodesBitmapPartSizeShiftRight = bit_width(nodesBitmapPartSize) - 1;
 	const int moduloByNodesBitmapPartSizeBitsAnd = nodesBitmapPartSize * BITS_IN_A_BYTE - 1;
 	
@@ -1640,47 +2504,146 @@ bool trimEdges(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPH
 			// Display message
 			cout << endl << "Allocating memory failed" << flush;
 			
-			// Return false
-			return false;
+			// Return failed
+			return TrimmingResult::FAILED;
 		}
 	}
 	
-	// Check if creating edges bitmap part failed
-	const size_t edgesBitmapPartSize = expansionRam ? LOCAL_RAM_SIZE : SECONDARY_LOCAL_RAM_SIZE;
+	// Set edges bitmap part size to the entire edges bitmap if it's in memory
+	const size_t edgesBitmapPartSize = edgesBitmap ? BYTES_PER_BITMAP : (expansionRam ? LOCAL_RAM_SIZE : SECONDARY_LOCAL_RAM_SIZE);
 	const int divideByEdgesBitmapPartSizeShiftRight = bit_width(edgesBitmapPartSize) - 1;
-	uint32_t *edgesBitmapPart = reinterpret_cast<uint32_t *>(alloca(edgesBitmapPartSize));
-	if(edgesBitmapPart < MAINRAM32 + edgesBitmapPartSize) {
 	
-		// Display message
-		cout << endl << "Allocating memory failed" << flush;
+	// Set edges bitmap part buffers to nothing
+	uint32_t *edgesBitmapPartBuffers[EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS] = {};
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Set edges bitmap parts memory to nothing
+		unique_ptr<uint8_t[]> edgesBitmapPartsMemory;
+	#endif
+	
+	// Check if edges bitmap isn't in memory
+	if(!edgesBitmap) {
+	
+		// Check if using Linux
+		#ifdef __linux__
 		
-		// Return false
-		return false;
+			// Check if creating edges bitmap parts memory failed
+			edgesBitmapPartsMemory = unique_ptr<uint8_t[]>(new(nothrow) uint8_t[edgesBitmapPartSize * EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS + DIRECT_EDGES_BITMAP_STORAGE_ALIGNMENT - 1]);
+			if(!edgesBitmapPartsMemory) {
+			
+				// Display message
+				cout << endl << "Allocating memory failed" << flush;
+				
+				// Return failed
+				return TrimmingResult::FAILED;
+			}
+			
+			// Go through all edges bitmap part buffers
+			for(int i = 0; i < EDGES_BITMAP_PIPELINE_NUMBER_OF_BUFFERS; ++i) {
+			
+				// Set edges bitmap part buffer to its part of the edges bitmap parts memory that's aligned for direct edges bitmap storage
+				edgesBitmapPartBuffers[i] = reinterpret_cast<uint32_t *>(((reinterpret_cast<uintptr_t>(edgesBitmapPartsMemory.get()) + DIRECT_EDGES_BITMAP_STORAGE_ALIGNMENT - 1) & ~static_cast<uintptr_t>(DIRECT_EDGES_BITMAP_STORAGE_ALIGNMENT - 1)) + i * edgesBitmapPartSize);
+			}
+		
+		// Otherwise
+		#else
+		
+			// Check if creating edges bitmap part buffer failed
+			edgesBitmapPartBuffers[0] = reinterpret_cast<uint32_t *>(alloca(edgesBitmapPartSize));
+			if(edgesBitmapPartBuffers[0] < MAINRAM32 + edgesBitmapPartSize) {
+			
+				// Display message
+				cout << endl << "Allocating memory failed" << flush;
+				
+				// Return failed
+				return TrimmingResult::FAILED;
+			}
+		#endif
 	}
 	
 	// Go through all edges bitmap parts
 	for(size_t i = 0; i < BYTES_PER_BITMAP >> divideByEdgesBitmapPartSizeShiftRight; ++i) {
 	
 		// Enable all edges in edges bitmap part
+		uint32_t *edgesBitmapPart = edgesBitmap ? edgesBitmap : edgesBitmapPartBuffers[0];
 		memset(edgesBitmapPart, UINT8_MAX, edgesBitmapPartSize);
 		
-		// Check if writing edges bitmap part to edges bitmap file failed
-		if(!edgesBitmapFile.write(reinterpret_cast<const char *>(edgesBitmapPart), edgesBitmapPartSize)) {
+		// Check if edges bitmap isn't in memory and writing edges bitmap part to edges bitmap file failed
+		if(!edgesBitmap && !edgesBitmapStorage.write(edgesBitmapPart, edgesBitmapPartSize, i * edgesBitmapPartSize)) {
 		
 			// Display message
 			cout << endl << "Writing to " EDGES_BITMAP_FILE " failed" << flush;
 			
-			// Return false
-			return false;
+			// Return failed
+			return TrimmingResult::FAILED;
 		}
 	}
 	
+	// Create edges bitmap pipeline
+	EdgesBitmapPipeline edgesBitmapPipeline(edgesBitmapStorage, edgesBitmap, edgesBitmapPartSize, edgesBitmapPartBuffers);
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Mean trimmer
+		static MeanTrimmer meanTrimmer;
+		
+		// Set mean trimmer loaded to false
+		bool meanTrimmerLoaded = false;
+	#endif
+	
+	// Set compact edge list loaded to false
+	bool compactEdgeListLoaded = false;
+	
 	// Go through all trimming rounds
+	numberOfEdges = NUMBER_OF_EDGES;
+	numberOfTrimmingRounds = 0;
+	size_t numberOfEdgesBeforeRoundPair = NUMBER_OF_EDGES;
 	int lastPercentComplete = 0;
-	for(int i = 0; i < TRIMMING_ROUNDS; ++i) {
+	for(int i = 0; i < MAX_TRIMMING_ROUNDS; ++i) {
 	
+		// Check if mining job was cancelled
+		if(isMiningJobCancelled()) {
+		
+			// Return cancelled
+			return TrimmingResult::CANCELLED;
+		}
+		
+		// Check if all trimming rounds are done and the remaining edges can be searched
+		if(i >= TRIMMING_ROUNDS && numberOfEdges <= MAX_NUMBER_OF_SEARCHED_EDGES) {
+		
+			// Break
+			break;
+		}
+		
+		// Check if the number of edges reached the trimming target
+		if(numberOfEdges <= trimmingTargetNumberOfEdges) {
+		
+			// Break
+			break;
+		}
+		
+		// Check if starting a round pair
+		if(!(i % 2)) {
+		
+			// Check if the previous round pair didn't disable any edges
+			if(i && numberOfEdges == numberOfEdgesBeforeRoundPair) {
+			
+				// Break
+				break;
+			}
+			
+			// Set number of edges before round pair
+			numberOfEdgesBeforeRoundPair = numberOfEdges;
+		}
+		
+		// Set number of trimming rounds
+		numberOfTrimmingRounds = i + 1;
+		
 		// Check if percent complete changed
-		const int percentComplete = i * 100 / TRIMMING_ROUNDS;
+		const int percentComplete = min(i * 100 / TRIMMING_ROUNDS, 99);
 		if(lastPercentComplete != percentComplete) {
 		
 			// Update last percent complete
@@ -1691,132 +2654,260 @@ bool trimEdges(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPH
 			cout << flush;
 		}
 		
-		// Go through all nodes bitmap parts
-		for(size_t j = 0; j < BYTES_PER_BITMAP >> divideByNodesBitmapPartSizeShiftRight; ++j) {
+		// Check if compact edge list isn't loaded and the number of edges is at or below the compact edge list threshold
+		if(!compactEdgeListLoaded && numberOfEdges <= compactEdgeListThreshold) {
 		
-			// Clear nodes bitmap part
-			memset(const_cast<uint16_t *>(nodesBitmapPart), 0, nodesBitmapPartSize);
-			
-			// Check if going to the beginning of edges bitmap file failed
-			if(!edgesBitmapFile.seekg(0)) {
-			
-				// Display message
-				cout << endl << "Reading from " EDGES_BITMAP_FILE " failed" << flush;
-				
-				// Return false
-				return false;
-			}
-			
-			// Go through all edges bitmap parts
-			for(size_t k = 0; k < BYTES_PER_BITMAP >> divideByEdgesBitmapPartSizeShiftRight; ++k) {
+			// Check if memory is available for the compact edge list to hold the edges
+			if(isMemoryAvailable(numberOfEdges * COMPACT_EDGE_LIST_BYTES_PER_EDGE) && compactEdgeList.reserve(numberOfEdges)) {
 			
-				// Check if reading edges bitmap part from edges bitmap file
-				if(!edgesBitmapFile.read(reinterpret_cast<char *>(edgesBitmapPart), edgesBitmapPartSize)) {
+				// Check if using Linux
+				#ifdef __linux__
 				
-					// Display message
-					cout << endl << "Reading from " EDGES_BITMAP_FILE " failed" << flush;
+					// Check if mean trimmer is loaded
+					if(meanTrimmerLoaded) {
 					
-					// Return false
-					return false;
+						// Store the mean trimmer's edges in the edges bitmap
+						meanTrimmer.store(edgesBitmap);
+						
+						// Set mean trimmer loaded to false
+						meanTrimmerLoaded = false;
+					}
+				#endif
+				
+				// Check if loading edges into the compact edge list failed
+				if(!loadEdgesIntoCompactEdgeList(sipHashKeys, edgesBitmapPipeline, edgesBitmapPartSize, compactEdgeList)) {
+				
+					// Display message
+					cout << endl << "Reading from " EDGES_BITMAP_FILE " failed" << flush;
+					
+					// Return failed
+					return TrimmingResult::FAILED;
 				}
 				
-				// Go through all groups of edges in the edges bitmap part
-				for(size_t l = 0; l < edgesBitmapPartSize / sizeof(edgesBitmapPart[0]); ++l) {
+				// Set compact edge list loaded to true
+				compactEdgeListLoaded = true;
+			}
+		}
+		
+		// Check if compact edge list is loaded
+		if(compactEdgeListLoaded) {
+		
+			// Trim edges using the compact edge list
+			compactEdgeList.trim(i % 2);
+			numberOfEdges = compactEdgeList.getNumberOfEdges();
+			
+			// Continue
+			continue;
+		}
+		
+		// Check if using Linux
+		#ifdef __linux__
+		
+			// Check if using the mean trimmer and edges bitmap is in memory
+			if(trimmerType == TrimmerType::MEAN && edgesBitmap) {
+			
+				// Check if mean trimmer isn't loaded
+				if(!meanTrimmerLoaded) {
 				
-					// Go through all enabled edges in the group
-					uint32_t edgeGroupBits = edgesBitmapPart[l];
-					for(int currentBitIndex = __builtin_ffs(edgeGroupBits), previousBitIndex = 0; currentBitIndex; edgeGroupBits >>= currentBitIndex, previousBitIndex += currentBitIndex, currentBitIndex = __builtin_ffs(edgeGroupBits)) {
+					// Check if memory is available for the mean trimmer to hold the edges
+					const size_t numberOfEdges = meanTrimmer.countEdges(*trimmingThreads, edgesBitmap);
+					if(numberOfEdges <= meanTrimmer.getCapacity() || isMemoryAvailable(numberOfEdges * MEAN_TRIMMER_BYTES_PER_EDGE)) {
 					
-						// Get edge's index
-						const uint32_t edgeIndex = ((k * BITS_IN_A_BYTE) << divideByEdgesBitmapPartSizeShiftRight) + l * (sizeof(edgesBitmapPart[0]) * BITS_IN_A_BYTE) + currentBitIndex - 1 + previousBitIndex;
-						
-						// Get edge's node on current partition
-						const uint32_t node = sipHash24(sipHashKeys, (edgeIndex * 2) | (i % 2)) & NODE_MASK;
-						
-						// Check if node belongs to the nodes bitmap part
-						if(((node / BITS_IN_A_BYTE) >> divideByNodesBitmapPartSizeShiftRight) == j) {
-						
-							// Enable node in nodes bitmap part
-							nodesBitmapPart[(node & moduloByNodesBitmapPartSizeBitsAnd) / (sizeof(nodesBitmapPart[0]) * BITS_IN_A_BYTE)] |= 1 << ((node & moduloByNodesBitmapPartSizeBitsAnd) % (sizeof(nodesBitmapPart[0]) * BITS_IN_A_BYTE));
-						}
-						
-						// Check if shifting by the entire group of bits
-						if(currentBitIndex == sizeof(edgeGroupBits) * BITS_IN_A_BYTE) {
-						
-							// Break
-							break;
-						}
+						// Set mean trimmer loaded to if loading the edges into the mean trimmer was successful
+						meanTrimmerLoaded = meanTrimmer.load(*trimmingThreads, edgesBitmap, numberOfEdges);
 					}
 				}
+				
+				// Check if mean trimmer is loaded
+				if(meanTrimmerLoaded) {
+				
+					// Trim edges using the mean trimmer
+					meanTrimmer.trim(*trimmingThreads, sipHashKeys, i % 2);
+					numberOfEdges = meanTrimmer.getNumberOfEdges();
+					
+					// Continue
+					continue;
+				}
+			}
+		#endif
+		
+		// Check if edges bitmap is in memory and it's split into multiple nodes bitmap parts
+		if(edgesBitmap && (BYTES_PER_BITMAP >> divideByNodesBitmapPartSizeShiftRight) > 1) {
+		
+			// Check if trimming edges using edge buckets was successful
+			bool cancelled;
+			if(trimEdgesUsingEdgeBuckets(sipHashKeys, edgesBitmap, i % 2, divideByNodesBitmapPartSizeShiftRight, moduloByNodesBitmapPartSizeBitsAnd, nodesBitmapPart, nodesBitmapPartSize, numberOfEdges, cancelled)) {
+			
+				// Check if mining job was cancelled
+				if(cancelled) {
+				
+					// Return cancelled
+					return TrimmingResult::CANCELLED;
+				}
+				
+				// Continue
+				continue;
+			}
+		}
+		
+		// Go through all nodes bitmap parts
+		for(size_t j = 0; j < BYTES_PER_BITMAP >> divideByNodesBitmapPartSizeShiftRight; ++j) {
+		
+			// Clear nodes bitmap part
+			memset(const_cast<uint16_t *>(nodesBitmapPart), 0, nodesBitmapPartSize);
+			
+			// Start reading edges bitmap parts
+			edgesBitmapPipeline.start(false);
+			
+			// Go through all edges bitmap parts
+			for(size_t k = 0; k < BYTES_PER_BITMAP >> divideByEdgesBitmapPartSizeShiftRight; ++k) {
+			
+				// Check if getting edges bitmap part failed
+				const uint32_t *edgesBitmapPart = edgesBitmapPipeline.getPart(k);
+				if(!edgesBitmapPart) {
+				
+					// Display message
+					cout << endl << "Reading from " EDGES_BITMAP_FILE " failed" << flush;
+					
+					// Return failed
+					return TrimmingResult::FAILED;
+				}
+				
+				// Check if using Linux
+				#ifdef __linux__
+				
+					// Enable nodes in nodes bitmap part using all trimming threads
+					trimmingThreads->run([&](const unsigned int threadIndex) {
+					
+						// Enable nodes for the thread's groups of edges in the edges bitmap part
+						enableNodesInNodesBitmapPart(sipHashKeys, edgesBitmapPart, edgesBitmapPartSize / sizeof(edgesBitmapPart[0]) * threadIndex / trimmingThreads->getNumberOfThreads(), edgesBitmapPartSize / sizeof(edgesBitmapPart[0]) * (threadIndex + 1) / trimmingThreads->getNumberOfThreads(), (k * BITS_IN_A_BYTE) << divideByEdgesBitmapPartSizeShiftRight, i % 2, j, divideByNodesBitmapPartSizeShiftRight, moduloByNodesBitmapPartSizeBitsAnd, nodesBitmapPart, trimmingThreads->getNumberOfThreads() != 1);
+					});
+				
+				// Otherwise
+				#else
+				
+					// Enable nodes for all groups of edges in the edges bitmap part
+					enableNodesInNodesBitmapPart(sipHashKeys, edgesBitmapPart, 0, edgesBitmapPartSize / sizeof(edgesBitmapPart[0]), (k * BITS_IN_A_BYTE) << divideByEdgesBitmapPartSizeShiftRight, i % 2, j, divideByNodesBitmapPartSizeShiftRight, moduloByNodesBitmapPartSizeBitsAnd, nodesBitmapPart, false);
+				#endif
+				
+				// Check if finishing edges bitmap part failed
+				if(!edgesBitmapPipeline.finishPart(k)) {
+				
+					// Display message
+					cout << endl << "Reading from " EDGES_BITMAP_FILE " failed" << flush;
+					
+					// Return failed
+					return TrimmingResult::FAILED;
+				}
 			}
 			
-			// Check if going to the beginning of edges bitmap file failed
-			if(!edgesBitmapFile.seekg(0)) {
+			// Check if finishing reading edges bitmap parts failed
+			if(!edgesBitmapPipeline.finish()) {
 			
 				// Display message
 				cout << endl << "Reading from " EDGES_BITMAP_FILE " failed" << flush;
 				
-				// Return false
-				return false;
+				// Return failed
+				return TrimmingResult::FAILED;
 			}
 			
+			// Start reading and writing back edges bitmap parts
+			edgesBitmapPipeline.start(true);
+			numberOfEdges = 0;
+			
 			// Go through all edges bitmap parts
 			for(size_t k = 0; k < BYTES_PER_BITMAP >> divideByEdgesBitmapPartSizeShiftRight; ++k) {
 			
-				// Check if reading edges bitmap part from edges bitmap file
-				const fstream::traits_type::pos_type edgesBitmapFilePosition = edgesBitmapFile.tellp();
-				if(edgesBitmapFilePosition == -1 || !edgesBitmapFile.read(reinterpret_cast<char *>(edgesBitmapPart), edgesBitmapPartSize) || !edgesBitmapFile.seekp(edgesBitmapFilePosition)) {
+				// Check if getting edges bitmap part failed
+				uint32_t *edgesBitmapPart = edgesBitmapPipeline.getPart(k);
+				if(!edgesBitmapPart) {
 				
 					// Display message
 					cout << endl << "Reading from " EDGES_BITMAP_FILE " failed" << flush;
 					
-					// Return false
-					return false;
+					// Return failed
+					return TrimmingResult::FAILED;
 				}
 				
-				// Go through all groups of edges in the edges bitmap part
-				for(size_t l = 0; l < edgesBitmapPartSize / sizeof(edgesBitmapPart[0]); ++l) {
+				// Check if using Linux
+				#ifdef __linux__
 				
-					// Go through all enabled edges in the group
-					uint32_t edgeGroupBits = edgesBitmapPart[l];
-					for(int currentBitIndex = __builtin_ffs(edgeGroupBits), previousBitIndex = 0; currentBitIndex; edgeGroupBits >>= currentBitIndex, previousBitIndex += currentBitIndex, currentBitIndex = __builtin_ffs(edgeGroupBits)) {
+					// Disable edges in edges bitmap part using all trimming threads
+					trimmingThreads->run([&](const unsigned int threadIndex) {
 					
-						// Get edge's index
-						const uint32_t edgeIndex = ((k * BITS_IN_A_BYTE) << divideByEdgesBitmapPartSizeShiftRight) + l * (sizeof(edgesBitmapPart[0]) * BITS_IN_A_BYTE) + currentBitIndex - 1 + previousBitIndex;
-						
-						// Get edge's node on current partition
-						const uint32_t node = sipHash24(sipHashKeys, (edgeIndex * 2) | (i % 2)) & NODE_MASK;
-						
-						// Check if node belongs to the nodes bitmap part
-						if(((node / BITS_IN_A_BYTE) >> divideByNodesBitmapPartSizeShiftRight) == j) {
-						
-							// Check if node's pair is disabled in nodes bitmap part
-							if(!(nodesBitmapPart[((node & moduloByNodesBitmapPartSizeBitsAnd) ^ 1) / (sizeof(nodesBitmapPart[0]) * BITS_IN_A_BYTE)] & (1 << (((node & moduloByNodesBitmapPartSizeBitsAnd) ^ 1) % (sizeof(nodesBitmapPart[0]) * BITS_IN_A_BYTE))))) {
-							
-								// Disable edge in edges bitmap part
-								edgesBitmapPart[l] ^= 1 << (edgeIndex % (sizeof(edgesBitmapPart[0]) * BITS_IN_A_BYTE));
-							}
-						}
-						
-						// Check if shifting by the entire group of bits
-						if(currentBitIndex == sizeof(edgeGroupBits) * BITS_IN_A_BYTE) {
-						
-							// Break
-							break;
-						}
-					}
-				}
+						// Disable edges without pairs for the thread's groups of edges in the edges bitmap part and add the remaining edges to the number of edges
+						__atomic_fetch_add(&numberOfEdges, disableEdgesWithoutPairsInEdgesBitmapPart(sipHashKeys, edgesBitmapPart, edgesBitmapPartSize / sizeof(edgesBitmapPart[0]) * threadIndex / trimmingThreads->getNumberOfThreads(), edgesBitmapPartSize / sizeof(edgesBitmapPart[0]) * (threadIndex + 1) / trimmingThreads->getNumberOfThreads(), (k * BITS_IN_A_BYTE) << divideByEdgesBitmapPartSizeShiftRight, i % 2, j, divideByNodesBitmapPartSizeShiftRight, moduloByNodesBitmapPartSizeBitsAnd, nodesBitmapPart), __ATOMIC_RELAXED);
+					});
+				
+				// Otherwise
+				#else
+				
+					// Disable edges without pairs for all groups of edges in the edges bitmap part and add the remaining edges to the number of edges
+					numberOfEdges += disableEdgesWithoutPairsInEdgesBitmapPart(sipHashKeys, edgesBitmapPart, 0, edgesBitmapPartSize / sizeof(edgesBitmapPart[0]), (k * BITS_IN_A_BYTE) << divideByEdgesBitmapPartSizeShiftRight, i % 2, j, divideByNodesBitmapPartSizeShiftRight, moduloByNodesBitmapPartSizeBitsAnd, nodesBitmapPart);
+				#endif
 				
-				// Check if writing edges bitmap part to edges bitmap file failed
-				if(!edgesBitmapFile.write(reinterpret_cast<const char *>(edgesBitmapPart), edgesBitmapPartSize)) {
+				// Check if finishing edges bitmap part failed
+				if(!edgesBitmapPipeline.finishPart(k)) {
 				
 					// Display message
 					cout << endl << "Writing to " EDGES_BITMAP_FILE " failed" << flush;
 					
-					// Return false
-					return false;
+					// Return failed
+					return TrimmingResult::FAILED;
 				}
 			}
+			
+			// Check if finishing reading and writing back edges bitmap parts failed
+			if(!edgesBitmapPipeline.finish()) {
+			
+				// Display message
+				cout << endl << "Writing to " EDGES_BITMAP_FILE " failed" << flush;
+				
+				// Return failed
+				return TrimmingResult::FAILED;
+			}
+			
+			// Check if mining job was cancelled
+			if(isMiningJobCancelled()) {
+			
+				// Return cancelled
+				return TrimmingResult::CANCELLED;
+			}
+		}
+	}
+	
+	// Check if compact edge list isn't loaded
+	if(!compactEdgeListLoaded) {
+	
+		// Check if using Linux
+		#ifdef __linux__
+		
+			// Check if mean trimmer is loaded
+			if(meanTrimmerLoaded) {
+			
+				// Store the mean trimmer's edges in the edges bitmap
+				meanTrimmer.store(edgesBitmap);
+			}
+		#endif
+		
+		// Check if creating the compact edge list to hand the remaining edges to the search failed
+		if(!compactEdgeList.reserve(numberOfEdges)) {
+		
+			// Display message
+			cout << endl << "Allocating memory failed" << flush;
+			
+			// Return abandoned
+			return TrimmingResult::ABANDONED;
+		}
+		
+		// Check if loading remaining edges into the compact edge list failed
+		if(!loadEdgesIntoCompactEdgeList(sipHashKeys, edgesBitmapPipeline, edgesBitmapPartSize, compactEdgeList)) {
+		
+			// Display message
+			cout << endl << "Reading from " EDGES_BITMAP_FILE " failed" << flush;
+			
+			// Return failed
+			return TrimmingResult::FAILED;
 		}
 	}
 	
@@ -1824,88 +2915,153 @@ bool trimEdges(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPH
 	iprintf("\x1b[%d;0HTrimming edges 100%%", console->cursorY);
 	cout << flush;
 	
-	// Return true
-	return true;
+	// Return succeeded
+	return TrimmingResult::SUCCEEDED;
 }
 
-// Search remaining edges
-bool searchRemainingEdges(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, fstream &edgesBitmapFile, uint32_t solution[SOLUTION_SIZE]) {
+// Enable nodes in nodes bitmap part
+void enableNodesInNodesBitmapPart(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *edgesBitmapPart, const size_t startingGroupIndex, const size_t endingGroupIndex, const uint32_t firstEdgeIndex, const int partition, const size_t nodesBitmapPartIndex, const int divideByNodesBitmapPartSizeShiftRight, const int moduloByNodesBitmapPartSizeBitsAnd, volatile uint16_t *nodesBitmapPart, [[maybe_unused]] const bool atomic) {
 
-	// Display message
-	cout << endl << "Searching remaining edges 0%" << flush;
-	
-	// Check if going to the beginning of edges bitmap file failed
-	if(!edgesBitmapFile.seekg(0)) {
-	
-		// Display message
-		cout << endl << "Reading from " EDGES_BITMAP_FILE " failed" << flush;
-		
-		// Return false
-		return false;
-	}
-	
-	// Create node connections
-	CuckatooNodeConnection nodeConnections[MAX_NUMBER_OF_EDGES_AFTER_TRIMMING * 2];
-	HashTable<CuckatooNodeConnection, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> newestUNodesConnection;
-	HashTable<CuckatooNodeConnection, MAX_NUMBER_OF_EDGES_AFTER_TRIMMING> newestVNodesConnection;
-	
-	// Go through all groups of edges in the edges bitmap file
-	uint32_t numberOfEdges = 0;
-	int lastPercentComplete = 0;
-	for(size_t i = 0; i < BYTES_PER_BITMAP / sizeof(uint32_t); ++i) {
+	// Go through the groups of edges in the edges bitmap part
+	uint32_t nonces[EDGES_BATCH_SIZE];
+	size_t numberOfNonces = 0;
+	for(size_t l = startingGroupIndex;; ++l) {
 	
-		// Check if percent complete changed
-		const int percentComplete = i * 100 / (BYTES_PER_BITMAP / sizeof(uint32_t));
-		if(lastPercentComplete != percentComplete) {
+		// Check if at the end of the groups or the nonces can't hold another group
+		if(l == endingGroupIndex || numberOfNonces > EDGES_BATCH_SIZE - sizeof(edgesBitmapPart[0]) * BITS_IN_A_BYTE) {
 		
-			// Update last percent complete
-			lastPercentComplete = percentComplete;
+			// Get nodes from the nonces
+			uint32_t nodes[EDGES_BATCH_SIZE];
+			sipHash24Batch(sipHashKeys, nonces, nodes, numberOfNonces);
 			
-			// Display message
-			iprintf("\x1b[%d;0HSearching remaining edges %d%%", console->cursorY, percentComplete);
-			cout << flush;
-		}
-		
-		// Check if reading group of edges from edges bitmap file failed
-		uint32_t edgeGroupBits;
-		if(!edgesBitmapFile.read(reinterpret_cast<char *>(&edgeGroupBits), sizeof(edgeGroupBits))) {
-		
-			// Display message
-			cout << endl << "Reading from " EDGES_BITMAP_FILE " failed" << flush;
+			// Go through all nodes
+			for(size_t m = 0; m < numberOfNonces; ++m) {
 			
-			// Return false
-			return false;
+				// Get node on current partition
+				const uint32_t node = nodes[m] & NODE_MASK;
+				
+				// Check if node belongs to the nodes bitmap part
+				if(((node / BITS_IN_A_BYTE) >> divideByNodesBitmapPartSizeShiftRight) == nodesBitmapPartIndex) {
+				
+					// Check if using Linux
+					#ifdef __linux__
+					
+						// Check if other threads are also enabling nodes in the nodes bitmap part
+						if(atomic) {
+						
+							// Check if node isn't already enabled in nodes bitmap part
+							volatile uint16_t &nodeGroup = nodesBitmapPart[(node & moduloByNodesBitmapPartSizeBitsAnd) / (sizeof(nodesBitmapPart[0]) * BITS_IN_A_BYTE)];
+							const uint16_t nodeBit = 1 << ((node & moduloByNodesBitmapPartSizeBitsAnd) % (sizeof(nodesBitmapPart[0]) * BITS_IN_A_BYTE));
+							if(!(nodeGroup & nodeBit)) {
+							
+								// Atomically enable node in nodes bitmap part
+								__atomic_fetch_or(&nodeGroup, nodeBit, __ATOMIC_RELAXED);
+							}
+						}
+						
+						// Otherwise
+						else {
+						
+							// Enable node in nodes bitmap part
+							volatile uint16_t &nodeGroup = nodesBitmapPart[(node & moduloByNodesBitmapPartSizeBitsAnd) / (sizeof(nodesBitmapPart[0]) * BITS_IN_A_BYTE)];
+							nodeGroup = nodeGroup | (1 << ((node & moduloByNodesBitmapPartSizeBitsAnd) % (sizeof(nodesBitmapPart[0]) * BITS_IN_A_BYTE)));
+						}
+					
+					// Otherwise
+					#else
+					
+						// Enable node in nodes bitmap part
+						nodesBitmapPart[(node & moduloByNodesBitmapPartSizeBitsAnd) / (sizeof(nodesBitmapPart[0]) * BITS_IN_A_BYTE)] |= 1 << ((node & moduloByNodesBitmapPartSizeBitsAnd) % (sizeof(nodesBitmapPart[0]) * BITS_IN_A_BYTE));
+					#endif
+				}
+			}
+			
+			// Check if at the end of the groups
+			numberOfNonces = 0;
+			if(l == endingGroupIndex) {
+			
+				// Break
+				break;
+			}
 		}
 		
 		// Go through all enabled edges in the group
+		uint32_t edgeGroupBits = edgesBitmapPart[l];
 		for(int currentBitIndex = __builtin_ffs(edgeGroupBits), previousBitIndex = 0; currentBitIndex; edgeGroupBits >>= currentBitIndex, previousBitIndex += currentBitIndex, currentBitIndex = __builtin_ffs(edgeGroupBits)) {
 		
-			// Check if the max number of edges have been searched
-			if(numberOfEdges == MAX_NUMBER_OF_EDGES_AFTER_TRIMMING) {
+			// Get edge's index
+			const uint32_t edgeIndex = firstEdgeIndex + l * (sizeof(edgesBitmapPart[0]) * BITS_IN_A_BYTE) + currentBitIndex - 1 + previousBitIndex;
 			
-				// Display message
-				cout << endl << "Too many edges remain. Some edges won't be searched" << flush;
-				
-				// Return true
-				return true;
+			// Add edge's nonce on current partition to the nonces
+			nonces[numberOfNonces++] = (edgeIndex * 2) | partition;
+			
+			// Check if shifting by the entire group of bits
+			if(currentBitIndex == sizeof(edgeGroupBits) * BITS_IN_A_BYTE) {
+			
+				// Break
+				break;
 			}
+		}
+	}
+}
+
+// Disable edges without pairs in edges bitmap part
+size_t disableEdgesWithoutPairsInEdgesBitmapPart(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, uint32_t *edgesBitmapPart, const size_t startingGroupIndex, const size_t endingGroupIndex, const uint32_t firstEdgeIndex, const int partition, const size_t nodesBitmapPartIndex, const int divideByNodesBitmapPartSizeShiftRight, const int moduloByNodesBitmapPartSizeBitsAnd, const volatile uint16_t *nodesBitmapPart) {
+
+	// Go through the groups of edges in the edges bitmap part
+	uint32_t nonces[EDGES_BATCH_SIZE];
+	size_t numberOfNonces = 0;
+	size_t numberOfEdges = 0;
+	for(size_t l = startingGroupIndex;; ++l) {
+	
+		// Check if at the end of the groups or the nonces can't hold another group
+		if(l == endingGroupIndex || numberOfNonces > EDGES_BATCH_SIZE - sizeof(edgesBitmapPart[0]) * BITS_IN_A_BYTE) {
+		
+			// Get nodes from the nonces
+			uint32_t nodes[EDGES_BATCH_SIZE];
+			sipHash24Batch(sipHashKeys, nonces, nodes, numberOfNonces);
 			
-			// Get edge's index
-			const uint32_t edgeIndex = i * (sizeof(edgeGroupBits) * BITS_IN_A_BYTE) + currentBitIndex - 1 + previousBitIndex;
+			// Go through all nodes
+			numberOfEdges += numberOfNonces;
+			for(size_t m = 0; m < numberOfNonces; ++m) {
 			
-			// Get edge's nodes on both partitions
-			const uint32_t uNode = sipHash24(sipHashKeys, edgeIndex * 2) & NODE_MASK;
-			const uint32_t vNode = sipHash24(sipHashKeys, (edgeIndex * 2) | 1) & NODE_MASK;
+				// Get node on current partition
+				const uint32_t node = nodes[m] & NODE_MASK;
+				
+				// Check if node belongs to the nodes bitmap part
+				if(((node / BITS_IN_A_BYTE) >> divideByNodesBitmapPartSizeShiftRight) == nodesBitmapPartIndex) {
+				
+					// Check if node's pair is disabled in nodes bitmap part
+					if(!(nodesBitmapPart[((node & moduloByNodesBitmapPartSizeBitsAnd) ^ 1) / (sizeof(nodesBitmapPart[0]) * BITS_IN_A_BYTE)] & (1 << (((node & moduloByNodesBitmapPartSizeBitsAnd) ^ 1) % (sizeof(nodesBitmapPart[0]) * BITS_IN_A_BYTE))))) {
+					
+						// Disable edge in edges bitmap part
+						const uint32_t edgeIndex = (nonces[m] / 2) - firstEdgeIndex;
+						edgesBitmapPart[edgeIndex / (sizeof(edgesBitmapPart[0]) * BITS_IN_A_BYTE)] ^= 1 << (edgeIndex % (sizeof(edgesBitmapPart[0]) * BITS_IN_A_BYTE));
+						
+						// Remove edge from the number of edges
+						--numberOfEdges;
+					}
+				}
+			}
 			
-			// Check if solution was found with adding the edge to the graph
-			if(getCuckatooSolution(edgeIndex, uNode, vNode, &nodeConnections[numberOfEdges * 2], newestUNodesConnection, newestVNodesConnection, solution)) {
+			// Check if at the end of the groups
+			numberOfNonces = 0;
+			if(l == endingGroupIndex) {
 			
-				// Return true
-				return true;
+				// Break
+				break;
 			}
+		}
+		
+		// Go through all enabled edges in the group
+		uint32_t edgeGroupBits = edgesBitmapPart[l];
+		for(int currentBitIndex = __builtin_ffs(edgeGroupBits), previousBitIndex = 0; currentBitIndex; edgeGroupBits >>= currentBitIndex, previousBitIndex += currentBitIndex, currentBitIndex = __builtin_ffs(edgeGroupBits)) {
+		
+			// Get edge's index
+			const uint32_t edgeIndex = firstEdgeIndex + l * (sizeof(edgesBitmapPart[0]) * BITS_IN_A_BYTE) + currentBitIndex - 1 + previousBitIndex;
 			
-			// Increment number of edges
-			++numberOfEdges;
+			// Add edge's nonce on current partition to the nonces
+			nonces[numberOfNonces++] = (edgeIndex * 2) | partition;
 			
 			// Check if shifting by the entire group of bits
 			if(currentBitIndex == sizeof(edgeGroupBits) * BITS_IN_A_BYTE) {
@@ -1916,6 +3072,712 @@ bool searchRemainingEdges(const uint64_t __attribute__((vector_size(sizeof(uint6
 		}
 	}
 	
+	// Return number of edges
+	return numberOfEdges;
+}
+
+// Trim edges using edge buckets
+bool trimEdgesUsingEdgeBuckets(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, uint32_t *edgesBitmap, const int partition, const int divideByNodesBitmapPartSizeShiftRight, const int moduloByNodesBitmapPartSizeBitsAnd, volatile uint16_t *nodesBitmapPart, const size_t nodesBitmapPartSize, size_t &numberOfEdges, bool &cancelled) {
+
+	// Set that trimming wasn't cancelled
+	cancelled = false;
+	
+	// Edge buckets
+	static unique_ptr<uint64_t[]> edgeBuckets;
+	
+	// Edges node
+	static unique_ptr<uint32_t[]> edgesNode;
+	
+	// Edge buckets capacity
+	static size_t edgeBucketsCapacity;
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Get number of trimming threads
+		const unsigned int numberOfTrimmingThreads = trimmingThreads->getNumberOfThreads();
+	
+	// Otherwise
+	#else
+	
+		// Set number of trimming threads to one
+		const unsigned int numberOfTrimmingThreads = 1;
+	#endif
+	
+	// Get number of nodes bitmap parts
+	const size_t numberOfNodesBitmapParts = BYTES_PER_BITMAP >> divideByNodesBitmapPartSizeShiftRight;
+	
+	// Check if creating trimming threads number of edges, trimming threads edge buckets offset, and edge buckets start failed
+	const unique_ptr<size_t[]> edgeBucketsIndices(new(nothrow) size_t[numberOfTrimmingThreads + numberOfTrimmingThreads * numberOfNodesBitmapParts + numberOfNodesBitmapParts + 1]);
+	if(!edgeBucketsIndices) {
+	
+		// Return false
+		return false;
+	}
+	size_t *trimmingThreadsNumberOfEdges = edgeBucketsIndices.get();
+	size_t *trimmingThreadsEdgeBucketsOffset = &trimmingThreadsNumberOfEdges[numberOfTrimmingThreads];
+	size_t *edgeBucketsStart = &trimmingThreadsEdgeBucketsOffset[numberOfTrimmingThreads * numberOfNodesBitmapParts];
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Count edges in edges bitmap using all trimming threads
+		trimmingThreads->run([&](const unsigned int threadIndex) {
+		
+			// Count edges for the thread's groups of edges in the edges bitmap
+			trimmingThreadsNumberOfEdges[threadIndex] = countEdgesInEdgesBitmap(edgesBitmap, BYTES_PER_BITMAP / sizeof(edgesBitmap[0]) * threadIndex / numberOfTrimmingThreads, BYTES_PER_BITMAP / sizeof(edgesBitmap[0]) * (threadIndex + 1) / numberOfTrimmingThreads);
+		});
+	
+	// Otherwise
+	#else
+	
+		// Count edges for all groups of edges in the edges bitmap
+		trimmingThreadsNumberOfEdges[0] = countEdgesInEdgesBitmap(edgesBitmap, 0, BYTES_PER_BITMAP / sizeof(edgesBitmap[0]));
+	#endif
+	
+	// Go through all trimming threads
+	numberOfEdges = 0;
+	for(unsigned int i = 0; i < numberOfTrimmingThreads; ++i) {
+	
+		// Set trimming thread's number of edges to its first edge's index in the edges node
+		const size_t trimmingThreadNumberOfEdges = trimmingThreadsNumberOfEdges[i];
+		trimmingThreadsNumberOfEdges[i] = numberOfEdges;
+		numberOfEdges += trimmingThreadNumberOfEdges;
+	}
+	
+	// Check if edge buckets can't hold all the edges
+	if(numberOfEdges > edgeBucketsCapacity) {
+	
+		// Free edge buckets and edges node
+		edgeBuckets.reset();
+		edgesNode.reset();
+		edgeBucketsCapacity = 0;
+		
+		// Check if memory isn't available for the edge buckets and edges node
+		if(!isMemoryAvailable(numberOfEdges * (sizeof(edgeBuckets[0]) + sizeof(edgesNode[0])))) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Check if creating edge buckets and edges node failed
+		edgeBuckets = unique_ptr<uint64_t[]>(new(nothrow) uint64_t[numberOfEdges]);
+		edgesNode = unique_ptr<uint32_t[]>(new(nothrow) uint32_t[numberOfEdges]);
+		if(!edgeBuckets || !edgesNode) {
+		
+			// Free edge buckets and edges node
+			edgeBuckets.reset();
+			edgesNode.reset();
+			
+			// Return false
+			return false;
+		}
+		
+		// Set edge buckets capacity
+		edgeBucketsCapacity = numberOfEdges;
+	}
+	
+	// Clear trimming threads edge buckets offset
+	memset(trimmingThreadsEdgeBucketsOffset, 0, sizeof(trimmingThreadsEdgeBucketsOffset[0]) * numberOfTrimmingThreads * numberOfNodesBitmapParts);
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Hash edges in edges bitmap using all trimming threads
+		trimmingThreads->run([&](const unsigned int threadIndex) {
+		
+			// Hash edges for the thread's groups of edges in the edges bitmap
+			hashEdgesInEdgesBitmap(sipHashKeys, edgesBitmap, BYTES_PER_BITMAP / sizeof(edgesBitmap[0]) * threadIndex / numberOfTrimmingThreads, BYTES_PER_BITMAP / sizeof(edgesBitmap[0]) * (threadIndex + 1) / numberOfTrimmingThreads, partition, divideByNodesBitmapPartSizeShiftRight, &edgesNode[trimmingThreadsNumberOfEdges[threadIndex]], &trimmingThreadsEdgeBucketsOffset[threadIndex * numberOfNodesBitmapParts]);
+		});
+	
+	// Otherwise
+	#else
+	
+		// Hash edges for all groups of edges in the edges bitmap
+		hashEdgesInEdgesBitmap(sipHashKeys, edgesBitmap, 0, BYTES_PER_BITMAP / sizeof(edgesBitmap[0]), partition, divideByNodesBitmapPartSizeShiftRight, edgesNode.get(), trimmingThreadsEdgeBucketsOffset);
+	#endif
+	
+	// Check if mining job was cancelled
+	if(isMiningJobCancelled()) {
+	
+		// Set that trimming was cancelled
+		cancelled = true;
+		
+		// Return true
+		return true;
+	}
+	
+	// Go through all edge buckets
+	for(size_t i = 0, edgeBucketsSize = 0; i < numberOfNodesBitmapParts; ++i) {
+	
+		// Set edge bucket's start
+		edgeBucketsStart[i] = edgeBucketsSize;
+		
+		// Go through all trimming threads
+		for(unsigned int j = 0; j < numberOfTrimmingThreads; ++j) {
+		
+			// Set trimming thread's size of the edge bucket to its offset in the edge buckets
+			const size_t trimmingThreadEdgeBucketSize = trimmingThreadsEdgeBucketsOffset[j * numberOfNodesBitmapParts + i];
+			trimmingThreadsEdgeBucketsOffset[j * numberOfNodesBitmapParts + i] = edgeBucketsSize;
+			edgeBucketsSize += trimmingThreadEdgeBucketSize;
+		}
+	}
+	edgeBucketsStart[numberOfNodesBitmapParts] = numberOfEdges;
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Route edges to edge buckets using all trimming threads
+		trimmingThreads->run([&](const unsigned int threadIndex) {
+		
+			// Route edges for the thread's groups of edges in the edges bitmap
+			routeEdgesToEdgeBuckets(edgesBitmap, BYTES_PER_BITMAP / sizeof(edgesBitmap[0]) * threadIndex / numberOfTrimmingThreads, BYTES_PER_BITMAP / sizeof(edgesBitmap[0]) * (threadIndex + 1) / numberOfTrimmingThreads, &edgesNode[trimmingThreadsNumberOfEdges[threadIndex]], divideByNodesBitmapPartSizeShiftRight, edgeBuckets.get(), &trimmingThreadsEdgeBucketsOffset[threadIndex * numberOfNodesBitmapParts]);
+		});
+	
+	// Otherwise
+	#else
+	
+		// Route edges for all groups of edges in the edges bitmap
+		routeEdgesToEdgeBuckets(edgesBitmap, 0, BYTES_PER_BITMAP / sizeof(edgesBitmap[0]), edgesNode.get(), divideByNodesBitmapPartSizeShiftRight, edgeBuckets.get(), trimmingThreadsEdgeBucketsOffset);
+	#endif
+	
+	// Go through all nodes bitmap parts
+	for(size_t i = 0; i < numberOfNodesBitmapParts; ++i) {
+	
+		// Get nodes bitmap part's edge bucket
+		const uint64_t *edgeBucket = &edgeBuckets[edgeBucketsStart[i]];
+		const size_t edgeBucketSize = edgeBucketsStart[i + 1] - edgeBucketsStart[i];
+		
+		// Clear nodes bitmap part
+		memset(const_cast<uint16_t *>(nodesBitmapPart), 0, nodesBitmapPartSize);
+		
+		// Check if using Linux
+		#ifdef __linux__
+		
+			// Enable nodes in nodes bitmap part using all trimming threads
+			trimmingThreads->run([&](const unsigned int threadIndex) {
+			
+				// Enable nodes for the thread's entries in the edge bucket
+				enableNodesInNodesBitmapPartUsingEdgeBucket(edgeBucket, edgeBucketSize * threadIndex / numberOfTrimmingThreads, edgeBucketSize * (threadIndex + 1) / numberOfTrimmingThreads, moduloByNodesBitmapPartSizeBitsAnd, nodesBitmapPart, numberOfTrimmingThreads != 1);
+			});
+			
+			// Disable edges in edges bitmap using all trimming threads
+			trimmingThreads->run([&](const unsigned int threadIndex) {
+			
+				// Disable edges without pairs for the thread's entries in the edge bucket and remove them from the number of edges
+				__atomic_fetch_sub(&numberOfEdges, disableEdgesWithoutPairsInEdgesBitmapUsingEdgeBucket(edgeBucket, edgeBucketSize * threadIndex / numberOfTrimmingThreads, edgeBucketSize * (threadIndex + 1) / numberOfTrimmingThreads, moduloByNodesBitmapPartSizeBitsAnd, nodesBitmapPart, edgesBitmap, numberOfTrimmingThreads != 1), __ATOMIC_RELAXED);
+			});
+		
+		// Otherwise
+		#else
+		
+			// Enable nodes for all entries in the edge bucket
+			enableNodesInNodesBitmapPartUsingEdgeBucket(edgeBucket, 0, edgeBucketSize, moduloByNodesBitmapPartSizeBitsAnd, nodesBitmapPart, false);
+			
+			// Disable edges without pairs for all entries in the edge bucket and remove them from the number of edges
+			numberOfEdges -= disableEdgesWithoutPairsInEdgesBitmapUsingEdgeBucket(edgeBucket, 0, edgeBucketSize, moduloByNodesBitmapPartSizeBitsAnd, nodesBitmapPart, edgesBitmap, false);
+		#endif
+		
+		// Check if mining job was cancelled
+		if(isMiningJobCancelled()) {
+		
+			// Set that trimming was cancelled
+			cancelled = true;
+			
+			// Return true
+			return true;
+		}
+	}
+	
+	// Return true
+	return true;
+}
+
+// Count edges in edges bitmap
+size_t countEdgesInEdgesBitmap(const uint32_t *edgesBitmap, const size_t startingGroupIndex, const size_t endingGroupIndex) {
+
+	// Go through the groups of edges in the edges bitmap
+	size_t numberOfEdges = 0;
+	for(size_t i = startingGroupIndex; i < endingGroupIndex; ++i) {
+	
+		// Add number of enabled edges in the group to the number of edges
+		numberOfEdges += __builtin_popcount(edgesBitmap[i]);
+	}
+	
+	// Return number of edges
+	return numberOfEdges;
+}
+
+// Hash edges in edges bitmap
+void hashEdgesInEdgesBitmap(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *edgesBitmap, const size_t startingGroupIndex, const size_t endingGroupIndex, const int partition, const int divideByNodesBitmapPartSizeShiftRight, uint32_t *edgesNode, size_t *edgeBucketsSize) {
+
+	// Go through the groups of edges in the edges bitmap
+	size_t numberOfEdges = 0;
+	for(size_t i = startingGroupIndex; i < endingGroupIndex; ++i) {
+	
+		// Go through all enabled edges in the group
+		uint32_t edgeGroupBits = edgesBitmap[i];
+		for(int currentBitIndex = __builtin_ffs(edgeGroupBits), previousBitIndex = 0; currentBitIndex; edgeGroupBits >>= currentBitIndex, previousBitIndex += currentBitIndex, currentBitIndex = __builtin_ffs(edgeGroupBits)) {
+		
+			// Get edge's index
+			const uint32_t edgeIndex = i * (sizeof(edgesBitmap[0]) * BITS_IN_A_BYTE) + currentBitIndex - 1 + previousBitIndex;
+			
+			// Set edge's nonce on current partition in the edges node
+			edgesNode[numberOfEdges++] = (edgeIndex * 2) | partition;
+			
+			// Check if shifting by the entire group of bits
+			if(currentBitIndex == sizeof(edgeGroupBits) * BITS_IN_A_BYTE) {
+			
+				// Break
+				break;
+			}
+		}
+	}
+	
+	// Replace the nonces in the edges node with their nodes
+	sipHash24Batch(sipHashKeys, edgesNode, edgesNode, numberOfEdges);
+	
+	// Go through all edges
+	for(size_t i = 0; i < numberOfEdges; ++i) {
+	
+		// Get edge's node on current partition
+		const uint32_t node = edgesNode[i] & NODE_MASK;
+		edgesNode[i] = node;
+		
+		// Increment size of the node's nodes bitmap part's edge bucket
+		++edgeBucketsSize[(node / BITS_IN_A_BYTE) >> divideByNodesBitmapPartSizeShiftRight];
+	}
+}
+
+// Route edges to edge buckets
+void routeEdgesToEdgeBuckets(const uint32_t *edgesBitmap, const size_t startingGroupIndex, const size_t endingGroupIndex, const uint32_t *edgesNode, const int divideByNodesBitmapPartSizeShiftRight, uint64_t *edgeBuckets, size_t *edgeBucketsOffset) {
+
+	// Go through the groups of edges in the edges bitmap
+	for(size_t i = startingGroupIndex; i < endingGroupIndex; ++i) {
+	
+		// Go through all enabled edges in the group
+		uint32_t edgeGroupBits = edgesBitmap[i];
+		for(int currentBitIndex = __builtin_ffs(edgeGroupBits), previousBitIndex = 0; currentBitIndex; edgeGroupBits >>= currentBitIndex, previousBitIndex += currentBitIndex, currentBitIndex = __builtin_ffs(edgeGroupBits)) {
+		
+			// Get edge's index
+			const uint32_t edgeIndex = i * (sizeof(edgesBitmap[0]) * BITS_IN_A_BYTE) + currentBitIndex - 1 + previousBitIndex;
+			
+			// Get edge's node
+			const uint32_t node = *edgesNode++;
+			
+			// Add edge and its node to the node's nodes bitmap part's edge bucket
+			edgeBuckets[edgeBucketsOffset[(node / BITS_IN_A_BYTE) >> divideByNodesBitmapPartSizeShiftRight]++] = (static_cast<uint64_t>(node) << (sizeof(edgeIndex) * BITS_IN_A_BYTE)) | edgeIndex;
+			
+			// Check if shifting by the entire group of bits
+			if(currentBitIndex == sizeof(edgeGroupBits) * BITS_IN_A_BYTE) {
+			
+				// Break
+				break;
+			}
+		}
+	}
+}
+
+// Enable nodes in nodes bitmap part using edge bucket
+void enableNodesInNodesBitmapPartUsingEdgeBucket(const uint64_t *edgeBucket, const size_t startingEntryIndex, const size_t endingEntryIndex, const int moduloByNodesBitmapPartSizeBitsAnd, volatile uint16_t *nodesBitmapPart, [[maybe_unused]] const bool atomic) {
+
+	// Go through the entries in the edge bucket
+	for(size_t i = startingEntryIndex; i < endingEntryIndex; ++i) {
+	
+		// Get entry's node's group and bit in nodes bitmap part
+		const uint32_t node = edgeBucket[i] >> (sizeof(uint32_t) * BITS_IN_A_BYTE);
+		volatile uint16_t &nodeGroup = nodesBitmapPart[(node & moduloByNodesBitmapPartSizeBitsAnd) / (sizeof(nodesBitmapPart[0]) * BITS_IN_A_BYTE)];
+		const uint16_t nodeBit = 1 << ((node & moduloByNodesBitmapPartSizeBitsAnd) % (sizeof(nodesBitmapPart[0]) * BITS_IN_A_BYTE));
+		
+		// Check if using Linux
+		#ifdef __linux__
+		
+			// Check if other threads are also enabling nodes in the nodes bitmap part
+			if(atomic) {
+			
+				// Check if node isn't already enabled in nodes bitmap part
+				if(!(nodeGroup & nodeBit)) {
+				
+					// Atomically enable node in nodes bitmap part
+					__atomic_fetch_or(&nodeGroup, nodeBit, __ATOMIC_RELAXED);
+				}
+				
+				// Continue
+				continue;
+			}
+		#endif
+		
+		// Enable node in nodes bitmap part
+		nodeGroup = nodeGroup | nodeBit;
+	}
+}
+
+// Disable edges without pairs in edges bitmap using edge bucket
+size_t disableEdgesWithoutPairsInEdgesBitmapUsingEdgeBucket(const uint64_t *edgeBucket, const size_t startingEntryIndex, const size_t endingEntryIndex, const int moduloByNodesBitmapPartSizeBitsAnd, const volatile uint16_t *nodesBitmapPart, uint32_t *edgesBitmap, [[maybe_unused]] const bool atomic) {
+
+	// Go through the entries in the edge bucket
+	size_t numberOfDisabledEdges = 0;
+	for(size_t i = startingEntryIndex; i < endingEntryIndex; ++i) {
+	
+		// Get entry's node
+		const uint32_t node = edgeBucket[i] >> (sizeof(uint32_t) * BITS_IN_A_BYTE);
+		
+		// Check if node's pair is disabled in nodes bitmap part
+		if(!(nodesBitmapPart[((node & moduloByNodesBitmapPartSizeBitsAnd) ^ 1) / (sizeof(nodesBitmapPart[0]) * BITS_IN_A_BYTE)] & (1 << (((node & moduloByNodesBitmapPartSizeBitsAnd) ^ 1) % (sizeof(nodesBitmapPart[0]) * BITS_IN_A_BYTE))))) {
+		
+			// Get entry's edge index
+			const uint32_t edgeIndex = edgeBucket[i];
+			++numberOfDisabledEdges;
+			
+			// Check if using Linux
+			#ifdef __linux__
+			
+				// Check if other threads are also disabling edges in the edges bitmap
+				if(atomic) {
+				
+					// Atomically disable edge in edges bitmap
+					__atomic_fetch_xor(&edgesBitmap[edgeIndex / (sizeof(edgesBitmap[0]) * BITS_IN_A_BYTE)], 1 << (edgeIndex % (sizeof(edgesBitmap[0]) * BITS_IN_A_BYTE)), __ATOMIC_RELAXED);
+				}
+				
+				// Otherwise
+				else {
+				
+					// Disable edge in edges bitmap
+					edgesBitmap[edgeIndex / (sizeof(edgesBitmap[0]) * BITS_IN_A_BYTE)] ^= 1 << (edgeIndex % (sizeof(edgesBitmap[0]) * BITS_IN_A_BYTE));
+				}
+			
+			// Otherwise
+			#else
+			
+				// Disable edge in edges bitmap
+				edgesBitmap[edgeIndex / (sizeof(edgesBitmap[0]) * BITS_IN_A_BYTE)] ^= 1 << (edgeIndex % (sizeof(edgesBitmap[0]) * BITS_IN_A_BYTE));
+			#endif
+		}
+	}
+	
+	// Return number of disabled edges
+	return numberOfDisabledEdges;
+}
+
+// Load edges into compact edge list
+bool loadEdgesIntoCompactEdgeList(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, EdgesBitmapPipeline &edgesBitmapPipeline, const size_t edgesBitmapPartSize, CompactEdgeList &compactEdgeList) {
+
+	// Clear compact edge list
+	compactEdgeList.clear();
+	
+	// Start reading edges bitmap parts
+	edgesBitmapPipeline.start(false);
+	
+	// Go through all edges bitmap parts
+	for(size_t i = 0; i < BYTES_PER_BITMAP / edgesBitmapPartSize; ++i) {
+	
+		// Check if getting edges bitmap part failed
+		const uint32_t *edgesBitmapPart = edgesBitmapPipeline.getPart(i);
+		if(!edgesBitmapPart) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Go through all groups of edges in the edges bitmap part
+		uint32_t nonces[EDGES_BATCH_SIZE];
+		size_t numberOfNonces = 0;
+		for(size_t j = 0;; ++j) {
+		
+			// Check if at the end of the groups or the nonces can't hold another group
+			if(j == edgesBitmapPartSize / sizeof(edgesBitmapPart[0]) || numberOfNonces > EDGES_BATCH_SIZE - sizeof(edgesBitmapPart[0]) * BITS_IN_A_BYTE * 2) {
+			
+				// Get nodes from the nonces
+				uint32_t nodes[EDGES_BATCH_SIZE];
+				sipHash24Batch(sipHashKeys, nonces, nodes, numberOfNonces);
+				
+				// Go through all pairs of nodes
+				for(size_t k = 0; k < numberOfNonces; k += 2) {
+				
+					// Add edge and its nodes to the compact edge list
+					compactEdgeList.add(nonces[k] / 2, nodes[k] & NODE_MASK, nodes[k + 1] & NODE_MASK);
+				}
+				
+				// Check if at the end of the groups
+				numberOfNonces = 0;
+				if(j == edgesBitmapPartSize / sizeof(edgesBitmapPart[0])) {
+				
+					// Break
+					break;
+				}
+			}
+			
+			// Go through all enabled edges in the group
+			uint32_t edgeGroupBits = edgesBitmapPart[j];
+			for(int currentBitIndex = __builtin_ffs(edgeGroupBits), previousBitIndex = 0; currentBitIndex; edgeGroupBits >>= currentBitIndex, previousBitIndex += currentBitIndex, currentBitIndex = __builtin_ffs(edgeGroupBits)) {
+			
+				// Get edge's index
+				const uint32_t edgeIndex = i * edgesBitmapPartSize * BITS_IN_A_BYTE + j * (sizeof(edgesBitmapPart[0]) * BITS_IN_A_BYTE) + currentBitIndex - 1 + previousBitIndex;
+				
+				// Add edge's nonces on both partitions to the nonces
+				nonces[numberOfNonces++] = edgeIndex * 2;
+				nonces[numberOfNonces++] = (edgeIndex * 2) | 1;
+				
+				// Check if shifting by the entire group of bits
+				if(currentBitIndex == sizeof(edgeGroupBits) * BITS_IN_A_BYTE) {
+				
+					// Break
+					break;
+				}
+			}
+		}
+		
+		// Check if finishing edges bitmap part failed
+		if(!edgesBitmapPipeline.finishPart(i)) {
+		
+			// Return false
+			return false;
+		}
+	}
+	
+	// Return if finishing reading edges bitmap parts was successful
+	return edgesBitmapPipeline.finish();
+}
+
+// Search remaining edges
+bool searchRemainingEdges(const CompactEdge *edges, const size_t numberOfRemainingEdges, uint32_t solutions[MAX_NUMBER_OF_SOLUTIONS][SOLUTION_SIZE], size_t &numberOfSolutions, bool &cancelled) {
+
+	// Set that searching wasn't cancelled
+	cancelled = false;
+	
+	
+	// Check if too many edges remain to search all of them
+	const size_t maxNumberOfEdges = min(numberOfRemainingEdges, static_cast<size_t>(MAX_NUMBER_OF_SEARCHED_EDGES));
+	if(numberOfRemainingEdges > maxNumberOfEdges) {
+	
+		// Display message
+		cout << endl << "Too many edges remain. Some edges won't be searched" << flush;
+	}
+	
+	// Display message
+	cout << endl << "Searching remaining edges 0%" << flush;
+	
+	// Check if creating components failed
+	CuckatooComponents components;
+	if(!createCuckatooComponents(components, maxNumberOfEdges)) {
+	
+		// Display message
+		cout << endl << "Allocating memory failed" << flush;
+		
+		// Return false
+		return false;
+	}
+	
+	// Get components that could contain a solution
+	uint32_t numberOfComponents;
+	{
+		// Check if creating node pairs edge failed
+		HashTable<uint32_t> uNodePairsEdge;
+		HashTable<uint32_t> vNodePairsEdge;
+		if(!uNodePairsEdge.reserve(maxNumberOfEdges) || !vNodePairsEdge.reserve(maxNumberOfEdges)) {
+		
+			// Display message
+			cout << endl << "Allocating memory failed" << flush;
+			
+			// Return false
+			return false;
+		}
+		
+		// Split edges into components and only keep the ones that have a cycle and enough edges for a solution
+		numberOfComponents = getCuckatooComponentsEdges(edges, components, maxNumberOfEdges, uNodePairsEdge, vNodePairsEdge);
+	}
+	
+	// Go through all components
+	uint32_t maxComponentNumberOfEdges = 0;
+	for(uint32_t i = 0; i < numberOfComponents; ++i) {
+	
+		// Update max component number of edges
+		maxComponentNumberOfEdges = max(maxComponentNumberOfEdges, components.componentsStart[i + 1] - components.componentsStart[i]);
+	}
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Get number of search threads that fit in memory
+		unsigned int numberOfSearchThreads = max(min(trimmingThreads->getNumberOfThreads(), numberOfComponents), 1U);
+		while(numberOfSearchThreads > 1 && !isMemoryAvailable(maxComponentNumberOfEdges * SEARCH_BYTES_PER_EDGE * numberOfSearchThreads)) {
+		
+			// Decrement number of search threads
+			--numberOfSearchThreads;
+		}
+	
+	// Otherwise
+	#else
+	
+		// Set number of search threads to one
+		const unsigned int numberOfSearchThreads = 1;
+	#endif
+	
+	// Check if creating search threads node connections, newest nodes connection, and visited node pairs failed
+	const unique_ptr<CuckatooNodeConnections[]> searchThreadsNodeConnections(new(nothrow) CuckatooNodeConnections[numberOfSearchThreads]);
+	const unique_ptr<HashTable<uint32_t>[]> searchThreadsNewestNodesConnection(new(nothrow) HashTable<uint32_t>[numberOfSearchThreads * 2]);
+	const unique_ptr<HashTable<uint32_t>[]> searchThreadsVisitedNodePairs(new(nothrow) HashTable<uint32_t>[numberOfSearchThreads * 2]);
+	if(!searchThreadsNodeConnections || !searchThreadsNewestNodesConnection || !searchThreadsVisitedNodePairs) {
+	
+		// Display message
+		cout << endl << "Allocating memory failed" << flush;
+		
+		// Return false
+		return false;
+	}
+	
+	// Go through all search threads
+	for(unsigned int i = 0; i < numberOfSearchThreads; ++i) {
+	
+		// Check if creating search thread's node connections, newest nodes connection, and visited node pairs failed
+		if(!createCuckatooNodeConnections(searchThreadsNodeConnections[i], maxComponentNumberOfEdges) || !searchThreadsNewestNodesConnection[i * 2].reserve(maxComponentNumberOfEdges) || !searchThreadsNewestNodesConnection[i * 2 + 1].reserve(maxComponentNumberOfEdges) || !searchThreadsVisitedNodePairs[i * 2].reserve(SOLUTION_SIZE / 2) || !searchThreadsVisitedNodePairs[i * 2 + 1].reserve(SOLUTION_SIZE / 2)) {
+		
+			// Display message
+			cout << endl << "Allocating memory failed" << flush;
+			
+			// Return false
+			return false;
+		}
+	}
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Solutions lock
+		mutex solutionsLock;
+	#endif
+	
+	// Search components
+	uint32_t nextComponent = 0;
+	size_t numberOfSearchedEdges = 0;
+	bool stopSearching = false;
+	const auto searchComponents = [&](const unsigned int threadIndex) {
+	
+		// Check if thread isn't a search thread
+		if(threadIndex >= numberOfSearchThreads) {
+		
+			// Return
+			return;
+		}
+		
+		// Get search thread's node connections, newest nodes connection, and visited node pairs
+		CuckatooNodeConnections &nodeConnections = searchThreadsNodeConnections[threadIndex];
+		HashTable<uint32_t> &newestUNodesConnection = searchThreadsNewestNodesConnection[threadIndex * 2];
+		HashTable<uint32_t> &newestVNodesConnection = searchThreadsNewestNodesConnection[threadIndex * 2 + 1];
+		HashTable<uint32_t> &visitedUNodePairs = searchThreadsVisitedNodePairs[threadIndex * 2];
+		HashTable<uint32_t> &visitedVNodePairs = searchThreadsVisitedNodePairs[threadIndex * 2 + 1];
+		
+		// Go through all components that another search thread didn't take
+		int lastPercentComplete = 0;
+		for(uint32_t i = __atomic_fetch_add(&nextComponent, 1, __ATOMIC_RELAXED); i < numberOfComponents; i = __atomic_fetch_add(&nextComponent, 1, __ATOMIC_RELAXED)) {
+		
+			// Clear newest nodes connection
+			newestUNodesConnection.clear();
+			newestVNodesConnection.clear();
+			
+			// Go through all of the component's edges
+			for(uint32_t j = components.componentsStart[i]; j < components.componentsStart[i + 1]; ++j) {
+			
+				// Check if searching stopped
+				if(__atomic_load_n(&stopSearching, __ATOMIC_RELAXED)) {
+				
+					// Return
+					return;
+				}
+				
+				// Check if the component was just taken or enough of its edges were searched since the last check and mining job was cancelled
+				if(!((j - components.componentsStart[i]) % SEARCH_CANCELLATION_CHECK_INTERVAL) && isMiningJobCancelled()) {
+				
+					// Set that searching was cancelled
+					__atomic_store_n(&cancelled, true, __ATOMIC_RELAXED);
+					
+					// Stop searching
+					__atomic_store_n(&stopSearching, true, __ATOMIC_RELAXED);
+					
+					// Return
+					return;
+				}
+				
+				// Check if search thread is the main thread
+				if(!threadIndex) {
+				
+					// Check if percent complete changed
+					const int percentComplete = (__atomic_load_n(&numberOfSearchedEdges, __ATOMIC_RELAXED) + j - components.componentsStart[i]) * 100 / components.componentsStart[numberOfComponents];
+					if(lastPercentComplete != percentComplete) {
+					
+						// Update last percent complete
+						lastPercentComplete = percentComplete;
+						
+						// Display message
+						iprintf("\x1b[%d;0HSearching remaining edges %d%%", console->cursorY, percentComplete);
+						cout << flush;
+					}
+				}
+				
+				// Check if solution was found with adding the edge to the component's graph
+				const CompactEdge &edge = edges[components.componentsEdges[j]];
+				uint32_t solution[SOLUTION_SIZE];
+				if(getCuckatooSolution(edge.edgeIndex, edge.nodes[0], edge.nodes[1], nodeConnections, j - components.componentsStart[i], newestUNodesConnection, newestVNodesConnection, visitedUNodePairs, visitedVNodePairs, solution)) {
+				
+					// Check if using Linux
+					#ifdef __linux__
+					
+						// Lock solutions
+						const lock_guard<mutex> guard(solutionsLock);
+					#endif
+					
+					// Check if the max number of solutions haven't been found and solution wasn't already found
+					if(numberOfSolutions != MAX_NUMBER_OF_SOLUTIONS && find_if(solutions, solutions + numberOfSolutions, [&solution](const uint32_t *otherSolution) {
+					
+						// Return if solution is the same as the other solution
+						return equal(solution, solution + SOLUTION_SIZE, otherSolution);
+					}) == solutions + numberOfSolutions) {
+					
+						// Add solution to solutions
+						copy(solution, solution + SOLUTION_SIZE, solutions[numberOfSolutions++]);
+						
+						// Check if the max number of solutions have been found
+						if(numberOfSolutions == MAX_NUMBER_OF_SOLUTIONS) {
+						
+							// Stop searching
+							__atomic_store_n(&stopSearching, true, __ATOMIC_RELAXED);
+						}
+					}
+				}
+			}
+			
+			// Add component's edges to the number of searched edges
+			__atomic_fetch_add(&numberOfSearchedEdges, components.componentsStart[i + 1] - components.componentsStart[i], __ATOMIC_RELAXED);
+		}
+	};
+	
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Search components using all search threads
+		trimmingThreads->run(searchComponents);
+	
+	// Otherwise
+	#else
+	
+		// Search components
+		searchComponents(0);
+	#endif
+	
+	// Check if searching stopped
+	if(stopSearching) {
+	
+		// Check if searching stopped because the max number of solutions were found
+		if(numberOfSolutions == MAX_NUMBER_OF_SOLUTIONS) {
+		
+			// Display message
+			cout << endl << "Too many solutions found. Some edges won't be searched" << flush;
+		}
+		
+		// Return true
+		return true;
+	}
+	
 	// Display message
 	iprintf("\x1b[%d;0HSearching remaining edges 100%%", console->cursorY);
 	cout << flush;
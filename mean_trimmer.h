@@ -0,0 +1,384 @@
+// Header guard
+#ifndef MEAN_TRIMMER_H
+#define MEAN_TRIMMER_H
+
+
+// Header files
+using namespace std;
+
+
+// Constants
+
+// Mean trimmer bucket number of nodes bits
+#define MEAN_TRIMMER_BUCKET_NUMBER_OF_NODES_BITS (EDGE_BITS > 22 ? 20 : EDGE_BITS - 2)
+
+// Mean trimmer number of buckets
+#define MEAN_TRIMMER_NUMBER_OF_BUCKETS (NUMBER_OF_EDGES >> MEAN_TRIMMER_BUCKET_NUMBER_OF_NODES_BITS)
+
+// Mean trimmer bytes per edge
+#define MEAN_TRIMMER_BYTES_PER_EDGE (sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint64_t))
+
+
+// Classes
+
+// Trimmer type
+enum class TrimmerType {
+
+	// Lean
+	LEAN,
+	
+	// Mean
+	MEAN
+};
+
+// Mean trimmer class
+class MeanTrimmer final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline MeanTrimmer();
+		
+		// Get capacity
+		inline size_t getCapacity() const;
+		
+		// Get number of edges
+		inline size_t getNumberOfEdges() const;
+		
+		// Count edges
+		inline size_t countEdges(ThreadPool &threads, const uint32_t *edgesBitmap);
+		
+		// Load
+		inline bool load(ThreadPool &threads, const uint32_t *edgesBitmap, const size_t numberOfEdges);
+		
+		// Trim
+		inline void trim(ThreadPool &threads, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const int partition);
+		
+		// Store
+		inline void store(uint32_t *edgesBitmap) const;
+	
+	// Private
+	private:
+	
+		// Reserve threads
+		inline void reserveThreads(const unsigned int numberOfThreads);
+		
+		// Threads capacity
+		unsigned int threadsCapacity;
+		
+		// Threads number of edges
+		unique_ptr<size_t[]> threadsNumberOfEdges;
+		
+		// Threads buckets offset
+		unique_ptr<size_t[]> threadsBucketsOffset;
+		
+		// Buckets start
+		unique_ptr<size_t[]> bucketsStart;
+		
+		// Edges
+		unique_ptr<uint32_t[]> edges;
+		
+		// Edges node
+		unique_ptr<uint32_t[]> edgesNode;
+		
+		// Buckets
+		unique_ptr<uint64_t[]> buckets;
+		
+		// Capacity
+		size_t capacity;
+		
+		// Number of edges
+		size_t numberOfEdges;
+};
+
+
+// Supporting function implementation
+
+// Constructor
+MeanTrimmer::MeanTrimmer() :
+
+	// Set threads capacity to zero
+	threadsCapacity(0),
+	
+	// Create buckets start
+	bucketsStart(new size_t[MEAN_TRIMMER_NUMBER_OF_BUCKETS + 1]),
+	
+	// Set capacity to zero
+	capacity(0),
+	
+	// Set number of edges to zero
+	numberOfEdges(0)
+{
+}
+
+// Get capacity
+size_t MeanTrimmer::getCapacity() const {
+
+	// Return capacity
+	return capacity;
+}
+
+// Get number of edges
+size_t MeanTrimmer::getNumberOfEdges() const {
+
+	// Return number of edges
+	return numberOfEdges;
+}
+
+// Count edges
+size_t MeanTrimmer::countEdges(ThreadPool &threads, const uint32_t *edgesBitmap) {
+
+	// Reserve threads number of edges and threads buckets offset for the threads
+	reserveThreads(threads.getNumberOfThreads());
+	
+	// Count edges in edges bitmap using all threads
+	threads.run([this, &threads, edgesBitmap](const unsigned int threadIndex) {
+	
+		// Go through the thread's groups of edges in the edges bitmap
+		size_t threadNumberOfEdges = 0;
+		for(size_t i = BYTES_PER_BITMAP / sizeof(edgesBitmap[0]) * threadIndex / threads.getNumberOfThreads(); i < BYTES_PER_BITMAP / sizeof(edgesBitmap[0]) * (threadIndex + 1) / threads.getNumberOfThreads(); ++i) {
+		
+			// Add number of enabled edges in the group to the thread's number of edges
+			threadNumberOfEdges += __builtin_popcount(edgesBitmap[i]);
+		}
+		
+		// Set thread's number of edges
+		threadsNumberOfEdges[threadIndex] = threadNumberOfEdges;
+	});
+	
+	// Go through all threads
+	size_t numberOfEdges = 0;
+	for(unsigned int i = 0; i < threads.getNumberOfThreads(); ++i) {
+	
+		// Add thread's number of edges to the number of edges
+		numberOfEdges += threadsNumberOfEdges[i];
+	}
+	
+	// Return number of edges
+	return numberOfEdges;
+}
+
+// Load
+bool MeanTrimmer::load(ThreadPool &threads, const uint32_t *edgesBitmap, const size_t numberOfEdges) {
+
+	// Check if edges can't hold all the edges
+	if(numberOfEdges > capacity) {
+	
+		// Free edges, edges node, and buckets
+		edges.reset();
+		edgesNode.reset();
+		buckets.reset();
+		capacity = 0;
+		
+		// Check if creating edges, edges node, and buckets failed
+		edges = unique_ptr<uint32_t[]>(new(nothrow) uint32_t[numberOfEdges]);
+		edgesNode = unique_ptr<uint32_t[]>(new(nothrow) uint32_t[numberOfEdges]);
+		buckets = unique_ptr<uint64_t[]>(new(nothrow) uint64_t[numberOfEdges]);
+		if(!edges || !edgesNode || !buckets) {
+		
+			// Free edges, edges node, and buckets
+			edges.reset();
+			edgesNode.reset();
+			buckets.reset();
+			
+			// Return false
+			return false;
+		}
+		
+		// Set capacity
+		capacity = numberOfEdges;
+	}
+	
+	// Go through all threads
+	size_t firstEdgeIndex = 0;
+	for(unsigned int i = 0; i < threads.getNumberOfThreads(); ++i) {
+	
+		// Set thread's number of edges to its first edge's index in the edges
+		const size_t threadNumberOfEdges = threadsNumberOfEdges[i];
+		threadsNumberOfEdges[i] = firstEdgeIndex;
+		firstEdgeIndex += threadNumberOfEdges;
+	}
+	
+	// Add edges in edges bitmap to the edges using all threads
+	threads.run([this, &threads, edgesBitmap](const unsigned int threadIndex) {
+	
+		// Go through the thread's groups of edges in the edges bitmap
+		uint32_t *threadEdges = &edges[threadsNumberOfEdges[threadIndex]];
+		for(size_t i = BYTES_PER_BITMAP / sizeof(edgesBitmap[0]) * threadIndex / threads.getNumberOfThreads(); i < BYTES_PER_BITMAP / sizeof(edgesBitmap[0]) * (threadIndex + 1) / threads.getNumberOfThreads(); ++i) {
+		
+			// Go through all enabled edges in the group
+			uint32_t edgeGroupBits = edgesBitmap[i];
+			for(int currentBitIndex = __builtin_ffs(edgeGroupBits), previousBitIndex = 0; currentBitIndex; edgeGroupBits >>= currentBitIndex, previousBitIndex += currentBitIndex, currentBitIndex = __builtin_ffs(edgeGroupBits)) {
+			
+				// Add edge to the edges
+				*threadEdges++ = i * (sizeof(edgesBitmap[0]) * BITS_IN_A_BYTE) + currentBitIndex - 1 + previousBitIndex;
+				
+				// Check if shifting by the entire group of bits
+				if(currentBitIndex == sizeof(edgeGroupBits) * BITS_IN_A_BYTE) {
+				
+					// Break
+					break;
+				}
+			}
+		}
+	});
+	
+	// Set number of edges
+	this->numberOfEdges = numberOfEdges;
+	
+	// Return true
+	return true;
+}
+
+// Trim
+void MeanTrimmer::trim(ThreadPool &threads, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const int partition) {
+
+	// Get number of threads
+	const unsigned int numberOfThreads = threads.getNumberOfThreads();
+	
+	// Reserve threads number of edges and threads buckets offset for the threads
+	reserveThreads(numberOfThreads);
+	
+	// Hash edges and count the size of each of the thread's buckets using all threads
+	threads.run([this, &sipHashKeys, partition, numberOfThreads](const unsigned int threadIndex) {
+	
+		// Clear thread's buckets size
+		size_t *threadBucketsSize = &threadsBucketsOffset[threadIndex * MEAN_TRIMMER_NUMBER_OF_BUCKETS];
+		memset(threadBucketsSize, 0, sizeof(threadBucketsSize[0]) * MEAN_TRIMMER_NUMBER_OF_BUCKETS);
+		
+		// Go through the thread's edges
+		const size_t startingEdgeIndex = numberOfEdges * threadIndex / numberOfThreads;
+		const size_t endingEdgeIndex = numberOfEdges * (threadIndex + 1) / numberOfThreads;
+		for(size_t i = startingEdgeIndex; i < endingEdgeIndex; ++i) {
+		
+			// Set edge's nonce on current partition in the edges node
+			edgesNode[i] = (edges[i] * 2) | partition;
+		}
+		
+		// Replace the thread's nonces in the edges node with their nodes
+		sipHash24Batch(sipHashKeys, &edgesNode[startingEdgeIndex], &edgesNode[startingEdgeIndex], endingEdgeIndex - startingEdgeIndex);
+		
+		// Go through the thread's edges
+		for(size_t i = startingEdgeIndex; i < endingEdgeIndex; ++i) {
+		
+			// Set edge's node on current partition
+			const uint32_t node = edgesNode[i] & NODE_MASK;
+			edgesNode[i] = node;
+			
+			// Increment size of the node's bucket
+			++threadBucketsSize[node >> MEAN_TRIMMER_BUCKET_NUMBER_OF_NODES_BITS];
+		}
+	});
+	
+	// Go through all buckets
+	for(size_t i = 0, bucketsSize = 0; i < MEAN_TRIMMER_NUMBER_OF_BUCKETS; ++i) {
+	
+		// Set bucket's start
+		bucketsStart[i] = bucketsSize;
+		
+		// Go through all threads
+		for(unsigned int j = 0; j < numberOfThreads; ++j) {
+		
+			// Set thread's size of the bucket to its offset in the buckets
+			const size_t threadBucketSize = threadsBucketsOffset[j * MEAN_TRIMMER_NUMBER_OF_BUCKETS + i];
+			threadsBucketsOffset[j * MEAN_TRIMMER_NUMBER_OF_BUCKETS + i] = bucketsSize;
+			bucketsSize += threadBucketSize;
+		}
+	}
+	bucketsStart[MEAN_TRIMMER_NUMBER_OF_BUCKETS] = numberOfEdges;
+	
+	// Sort edges into their node's bucket using all threads
+	threads.run([this, numberOfThreads](const unsigned int threadIndex) {
+	
+		// Go through the thread's edges
+		size_t *threadBucketsOffset = &threadsBucketsOffset[threadIndex * MEAN_TRIMMER_NUMBER_OF_BUCKETS];
+		for(size_t i = numberOfEdges * threadIndex / numberOfThreads; i < numberOfEdges * (threadIndex + 1) / numberOfThreads; ++i) {
+		
+			// Add edge and its node to the node's bucket
+			buckets[threadBucketsOffset[edgesNode[i] >> MEAN_TRIMMER_BUCKET_NUMBER_OF_NODES_BITS]++] = (static_cast<uint64_t>(edges[i]) << (sizeof(uint32_t) * BITS_IN_A_BYTE)) | edgesNode[i];
+		}
+	});
+	
+	// Keep edges whose node has a pair using all threads
+	threads.run([this, numberOfThreads](const unsigned int threadIndex) {
+	
+		// Create nodes bitmap for a bucket
+		uint64_t nodesBitmap[(static_cast<size_t>(1) << MEAN_TRIMMER_BUCKET_NUMBER_OF_NODES_BITS) / (sizeof(uint64_t) * BITS_IN_A_BYTE)];
+		
+		// Go through the thread's buckets
+		size_t threadNumberOfEdges = 0;
+		for(size_t i = MEAN_TRIMMER_NUMBER_OF_BUCKETS * threadIndex / numberOfThreads; i < MEAN_TRIMMER_NUMBER_OF_BUCKETS * (threadIndex + 1) / numberOfThreads; ++i) {
+		
+			// Clear nodes bitmap
+			memset(nodesBitmap, 0, sizeof(nodesBitmap));
+			
+			// Go through all entries in the bucket
+			for(size_t j = bucketsStart[i]; j < bucketsStart[i + 1]; ++j) {
+			
+				// Enable entry's node in the nodes bitmap
+				const uint32_t node = buckets[j] & ((static_cast<uint32_t>(1) << MEAN_TRIMMER_BUCKET_NUMBER_OF_NODES_BITS) - 1);
+				nodesBitmap[node / (sizeof(nodesBitmap[0]) * BITS_IN_A_BYTE)] |= static_cast<uint64_t>(1) << (node % (sizeof(nodesBitmap[0]) * BITS_IN_A_BYTE));
+			}
+			
+			// Go through all entries in the bucket
+			for(size_t j = bucketsStart[i]; j < bucketsStart[i + 1]; ++j) {
+			
+				// Check if entry's node's pair is enabled in the nodes bitmap
+				const uint32_t node = (buckets[j] & ((static_cast<uint32_t>(1) << MEAN_TRIMMER_BUCKET_NUMBER_OF_NODES_BITS) - 1)) ^ 1;
+				if(nodesBitmap[node / (sizeof(nodesBitmap[0]) * BITS_IN_A_BYTE)] & (static_cast<uint64_t>(1) << (node % (sizeof(nodesBitmap[0]) * BITS_IN_A_BYTE)))) {
+				
+					// Keep entry's edge in the thread's part of the edges
+					edges[bucketsStart[MEAN_TRIMMER_NUMBER_OF_BUCKETS * threadIndex / numberOfThreads] + threadNumberOfEdges++] = buckets[j] >> (sizeof(uint32_t) * BITS_IN_A_BYTE);
+				}
+			}
+		}
+		
+		// Set thread's number of edges
+		threadsNumberOfEdges[threadIndex] = threadNumberOfEdges;
+	});
+	
+	// Go through all threads
+	size_t newNumberOfEdges = 0;
+	for(unsigned int i = 0; i < numberOfThreads; ++i) {
+	
+		// Move thread's kept edges to the end of the kept edges
+		memmove(&edges[newNumberOfEdges], &edges[bucketsStart[MEAN_TRIMMER_NUMBER_OF_BUCKETS * i / numberOfThreads]], sizeof(edges[0]) * threadsNumberOfEdges[i]);
+		newNumberOfEdges += threadsNumberOfEdges[i];
+	}
+	
+	// Set number of edges
+	numberOfEdges = newNumberOfEdges;
+}
+
+// Store
+void MeanTrimmer::store(uint32_t *edgesBitmap) const {
+
+	// Disable all edges in edges bitmap
+	memset(edgesBitmap, 0, BYTES_PER_BITMAP);
+	
+	// Go through all edges
+	for(size_t i = 0; i < numberOfEdges; ++i) {
+	
+		// Enable edge in edges bitmap
+		edgesBitmap[edges[i] / (sizeof(edgesBitmap[0]) * BITS_IN_A_BYTE)] |= 1 << (edges[i] % (sizeof(edgesBitmap[0]) * BITS_IN_A_BYTE));
+	}
+}
+
+// Reserve threads
+void MeanTrimmer::reserveThreads(const unsigned int numberOfThreads) {
+
+	// Check if threads number of edges and threads buckets offset can't hold all the threads
+	if(numberOfThreads > threadsCapacity) {
+	
+		// Create threads number of edges and threads buckets offset
+		threadsNumberOfEdges = unique_ptr<size_t[]>(new size_t[numberOfThreads]);
+		threadsBucketsOffset = unique_ptr<size_t[]>(new size_t[numberOfThreads * MEAN_TRIMMER_NUMBER_OF_BUCKETS]);
+		
+		// Set threads capacity
+		threadsCapacity = numberOfThreads;
+	}
+}
+
+
+#endif
@@ -15,6 +15,62 @@ using namespace std;
 // SipRound rotation
 #define SIP_ROUND_ROTATION 21
 
+// Check if using x86
+#if defined(__x86_64__) || defined(__i386__)
+
+	// SipHash-2-4 AVX2 number of lanes
+	#define SIPHASH24_AVX2_NUMBER_OF_LANES 4
+	
+	// SipHash-2-4 AVX-512 number of lanes
+	#define SIPHASH24_AVX512_NUMBER_OF_LANES 8
+#endif
+
+// Check if using Linux
+#ifdef __linux__
+
+	// SipHash-2-4 bitsliced number of lanes
+	#define SIPHASH24_BITSLICED_NUMBER_OF_LANES (sizeof(uint64_t) * BITS_IN_A_BYTE)
+	
+	// SipHash-2-4 batch calibration number of nonces
+	#define SIPHASH24_BATCH_CALIBRATION_NUMBER_OF_NONCES (SIPHASH24_BITSLICED_NUMBER_OF_LANES * 64)
+	
+	// SipHash-2-4 batch calibration number of runs
+	#define SIPHASH24_BATCH_CALIBRATION_NUMBER_OF_RUNS 3
+#endif
+
+
+// Classes
+
+// Check if using x86
+#if defined(__x86_64__) || defined(__i386__)
+
+	// SipHash-2-4 AVX2 lanes
+	typedef uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH24_AVX2_NUMBER_OF_LANES))) SipHash24Avx2Lanes;
+	
+	// SipHash-2-4 AVX2 nonce lanes
+	typedef uint32_t __attribute__((vector_size(sizeof(uint32_t) * SIPHASH24_AVX2_NUMBER_OF_LANES))) SipHash24Avx2NonceLanes;
+	
+	// SipHash-2-4 AVX-512 lanes
+	typedef uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH24_AVX512_NUMBER_OF_LANES))) SipHash24Avx512Lanes;
+	
+	// SipHash-2-4 AVX-512 nonce lanes
+	typedef uint32_t __attribute__((vector_size(sizeof(uint32_t) * SIPHASH24_AVX512_NUMBER_OF_LANES))) SipHash24Avx512NonceLanes;
+#endif
+
+// Check if using Linux
+#ifdef __linux__
+
+	// SipHash-2-4 bitsliced word structure
+	struct SipHash24BitslicedWord {
+	
+		// Slices
+		uint64_t slices[sizeof(uint64_t) * BITS_IN_A_BYTE];
+		
+		// Offset
+		int offset;
+	};
+#endif
+
 
 // Function prototypes
 
@@ -24,6 +80,62 @@ ITCM_CODE static inline uint32_t sipHash24(const uint64_t __attribute__((vector_
 // SipRound
 ITCM_CODE static inline void sipRound(uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &state);
 
+// SipHash-2-4 batch
+ITCM_CODE static inline void sipHash24Batch(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces);
+
+// SipHash-2-4 scalar batch
+ITCM_CODE static inline void sipHash24ScalarBatch(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces);
+
+// Check if using x86
+#if defined(__x86_64__) || defined(__i386__)
+
+	// SipHash-2-4 lanes
+	template<typename Lanes, typename NonceLanes> [[gnu::always_inline]] static inline void sipHash24Lanes(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results);
+	
+	// SipRound lanes
+	template<typename Lanes> [[gnu::always_inline]] static inline void sipRoundLanes(Lanes &v0, Lanes &v1, Lanes &v2, Lanes &v3);
+	
+	// Rotate lanes left
+	template<typename Lanes> [[gnu::always_inline]] static inline void rotateLanesLeft(Lanes &lanes, const int shift);
+	
+	// SipHash-2-4 AVX2 batch
+	__attribute__((target("avx2"))) static void sipHash24Avx2Batch(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces);
+	
+	// SipHash-2-4 AVX-512 batch
+	__attribute__((target("avx512f"))) static void sipHash24Avx512Batch(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces);
+#endif
+
+// Check if using Linux
+#ifdef __linux__
+
+	// SipHash-2-4 bitsliced batch
+	static void sipHash24BitslicedBatch(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces);
+	
+	// SipHash-2-4 bitsliced
+	static inline void sipHash24Bitsliced(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results);
+	
+	// SipRound bitsliced
+	static inline void sipRoundBitsliced(SipHash24BitslicedWord &v0, SipHash24BitslicedWord &v1, SipHash24BitslicedWord &v2, SipHash24BitslicedWord &v3);
+	
+	// Add bitsliced words
+	static inline void addBitslicedWords(SipHash24BitslicedWord &word, const SipHash24BitslicedWord &otherWord);
+	
+	// Exclusive or bitsliced words
+	static inline void exclusiveOrBitslicedWords(SipHash24BitslicedWord &word, const SipHash24BitslicedWord &otherWord);
+	
+	// Rotate bitsliced word left
+	static inline void rotateBitslicedWordLeft(SipHash24BitslicedWord &word, const int shift);
+	
+	// Transpose bit matrix
+	static inline void transposeBitMatrix(uint64_t rows[sizeof(uint64_t) * BITS_IN_A_BYTE]);
+	
+	// Get SipHash-2-4 batch function
+	static inline void (*getSipHash24BatchFunction())(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces);
+	
+	// Get SipHash-2-4 batch function duration
+	static inline chrono::steady_clock::duration getSipHash24BatchFunctionDuration(void (*sipHash24BatchFunction)(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces));
+#endif
+
 
 // Supporting function implementation
 
@@ -66,5 +178,344 @@ void sipRound(uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEY
 	state[2] = rotl(state[2], 32);
 }
 
+// Check if using Linux
+#ifdef __linux__
+
+	// SipHash-2-4 batch function
+	static void (*const sipHash24BatchFunction)(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces) = getSipHash24BatchFunction();
+#endif
+
+// SipHash-2-4 batch
+void sipHash24Batch(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces) {
+
+	// Check if using Linux
+	#ifdef __linux__
+	
+		// Perform hashes using the SipHash-2-4 batch function selected for the CPU
+		sipHash24BatchFunction(sipHashKeys, nonces, results, numberOfNonces);
+	
+	// Otherwise
+	#else
+	
+		// Perform hashes one at a time
+		sipHash24ScalarBatch(sipHashKeys, nonces, results, numberOfNonces);
+	#endif
+}
+
+// SipHash-2-4 scalar batch
+void sipHash24ScalarBatch(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces) {
+
+	// Go through all nonces
+	for(size_t i = 0; i < numberOfNonces; ++i) {
+	
+		// Perform hash using SipHash keys and nonce
+		results[i] = sipHash24(sipHashKeys, nonces[i]);
+	}
+}
+
+// Check if using x86
+#if defined(__x86_64__) || defined(__i386__)
+
+	// SipHash-2-4 lanes
+	template<typename Lanes, typename NonceLanes> void sipHash24Lanes(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results) {
+	
+		// Get nonces in lanes
+		NonceLanes nonceLanes;
+		memcpy(&nonceLanes, nonces, sizeof(nonceLanes));
+		const Lanes nonce = __builtin_convertvector(nonceLanes, Lanes);
+		
+		// Perform hashes using SipHash keys and nonces
+		Lanes v0 = Lanes{} + sipHashKeys[0];
+		Lanes v1 = Lanes{} + sipHashKeys[1];
+		Lanes v2 = Lanes{} + sipHashKeys[2];
+		Lanes v3 = (Lanes{} + sipHashKeys[3]) ^ nonce;
+		sipRoundLanes(v0, v1, v2, v3);
+		sipRoundLanes(v0, v1, v2, v3);
+		v0 ^= nonce;
+		v2 ^= 255;
+		sipRoundLanes(v0, v1, v2, v3);
+		sipRoundLanes(v0, v1, v2, v3);
+		sipRoundLanes(v0, v1, v2, v3);
+		sipRoundLanes(v0, v1, v2, v3);
+		
+		// Set results from lanes
+		nonceLanes = __builtin_convertvector(v0 ^ v1 ^ v2 ^ v3, NonceLanes);
+		memcpy(results, &nonceLanes, sizeof(nonceLanes));
+	}
+	
+	// SipRound lanes
+	template<typename Lanes> void sipRoundLanes(Lanes &v0, Lanes &v1, Lanes &v2, Lanes &v3) {
+	
+		// Perform SipRound on lanes
+		v0 += v1;
+		v2 += v3;
+		rotateLanesLeft(v1, 13);
+		rotateLanesLeft(v3, 16);
+		v1 ^= v0;
+		v3 ^= v2;
+		rotateLanesLeft(v0, 32);
+		v2 += v1;
+		v0 += v3;
+		rotateLanesLeft(v1, 17);
+		rotateLanesLeft(v3, SIP_ROUND_ROTATION);
+		v1 ^= v2;
+		v3 ^= v0;
+		rotateLanesLeft(v2, 32);
+	}
+	
+	// Rotate lanes left
+	template<typename Lanes> void rotateLanesLeft(Lanes &lanes, const int shift) {
+	
+		// Rotate lanes left by shift
+		lanes = (lanes << shift) | (lanes >> (sizeof(uint64_t) * BITS_IN_A_BYTE - shift));
+	}
+	
+	// SipHash-2-4 AVX2 batch
+	void sipHash24Avx2Batch(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces) {
+	
+		// Go through all groups of nonces that fill the lanes
+		size_t i = 0;
+		for(; i + SIPHASH24_AVX2_NUMBER_OF_LANES <= numberOfNonces; i += SIPHASH24_AVX2_NUMBER_OF_LANES) {
+		
+			// Perform hashes on the group of nonces
+			sipHash24Lanes<SipHash24Avx2Lanes, SipHash24Avx2NonceLanes>(sipHashKeys, &nonces[i], &results[i]);
+		}
+		
+		// Perform hashes on the remaining nonces one at a time
+		sipHash24ScalarBatch(sipHashKeys, &nonces[i], &results[i], numberOfNonces - i);
+	}
+	
+	// SipHash-2-4 AVX-512 batch
+	void sipHash24Avx512Batch(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces) {
+	
+		// Go through all groups of nonces that fill the lanes
+		size_t i = 0;
+		for(; i + SIPHASH24_AVX512_NUMBER_OF_LANES <= numberOfNonces; i += SIPHASH24_AVX512_NUMBER_OF_LANES) {
+		
+			// Perform hashes on the group of nonces
+			sipHash24Lanes<SipHash24Avx512Lanes, SipHash24Avx512NonceLanes>(sipHashKeys, &nonces[i], &results[i]);
+		}
+		
+		// Perform hashes on the remaining nonces one at a time
+		sipHash24ScalarBatch(sipHashKeys, &nonces[i], &results[i], numberOfNonces - i);
+	}
+#endif
+
+// Check if using Linux
+#ifdef __linux__
+
+	// SipHash-2-4 bitsliced batch
+	void sipHash24BitslicedBatch(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces) {
+	
+		// Go through all groups of nonces that fill the lanes
+		size_t i = 0;
+		for(; i + SIPHASH24_BITSLICED_NUMBER_OF_LANES <= numberOfNonces; i += SIPHASH24_BITSLICED_NUMBER_OF_LANES) {
+		
+			// Perform hashes on the group of nonces
+			sipHash24Bitsliced(sipHashKeys, &nonces[i], &results[i]);
+		}
+		
+		// Perform hashes on the remaining nonces one at a time
+		sipHash24ScalarBatch(sipHashKeys, &nonces[i], &results[i], numberOfNonces - i);
+	}
+	
+	// SipHash-2-4 bitsliced
+	void sipHash24Bitsliced(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results) {
+	
+		// Go through all lanes
+		SipHash24BitslicedWord nonce;
+		nonce.offset = 0;
+		for(size_t i = 0; i < SIPHASH24_BITSLICED_NUMBER_OF_LANES; ++i) {
+		
+			// Set lane's row to its nonce
+			nonce.slices[i] = nonces[i];
+		}
+		
+		// Transpose the rows so that each slice contains one bit of every lane's nonce
+		transposeBitMatrix(nonce.slices);
+		
+		// Go through all SipHash keys
+		SipHash24BitslicedWord state[SIPHASH_KEYS_SIZE];
+		for(int i = 0; i < SIPHASH_KEYS_SIZE; ++i) {
+		
+			// Go through all of the SipHash key's bits
+			state[i].offset = 0;
+			for(size_t j = 0; j < sizeof(uint64_t) * BITS_IN_A_BYTE; ++j) {
+			
+				// Set bit's slice to the bit in every lane
+				state[i].slices[j] = -((sipHashKeys[i] >> j) & 1);
+			}
+		}
+		
+		// Perform compression rounds using nonces
+		exclusiveOrBitslicedWords(state[3], nonce);
+		sipRoundBitsliced(state[0], state[1], state[2], state[3]);
+		sipRoundBitsliced(state[0], state[1], state[2], state[3]);
+		exclusiveOrBitslicedWords(state[0], nonce);
+		
+		// Go through all of the state's third word's least significant byte's bits
+		for(size_t i = 0; i < BITS_IN_A_BYTE; ++i) {
+		
+			// Invert bit's slice
+			uint64_t &slice = state[2].slices[(i + state[2].offset) % (sizeof(uint64_t) * BITS_IN_A_BYTE)];
+			slice = ~slice;
+		}
+		
+		// Perform finalization rounds
+		sipRoundBitsliced(state[0], state[1], state[2], state[3]);
+		sipRoundBitsliced(state[0], state[1], state[2], state[3]);
+		sipRoundBitsliced(state[0], state[1], state[2], state[3]);
+		sipRoundBitsliced(state[0], state[1], state[2], state[3]);
+		
+		// Go through all of the result's bits
+		uint64_t rows[sizeof(uint64_t) * BITS_IN_A_BYTE] = {};
+		for(size_t i = 0; i < sizeof(results[0]) * BITS_IN_A_BYTE; ++i) {
+		
+			// Set bit's row to the bit from the state in every lane
+			rows[i] = state[0].slices[(i + state[0].offset) % (sizeof(uint64_t) * BITS_IN_A_BYTE)] ^ state[1].slices[(i + state[1].offset) % (sizeof(uint64_t) * BITS_IN_A_BYTE)] ^ state[2].slices[(i + state[2].offset) % (sizeof(uint64_t) * BITS_IN_A_BYTE)] ^ state[3].slices[(i + state[3].offset) % (sizeof(uint64_t) * BITS_IN_A_BYTE)];
+		}
+		
+		// Transpose the rows so that each row contains one lane's result
+		transposeBitMatrix(rows);
+		
+		// Go through all lanes
+		for(size_t i = 0; i < SIPHASH24_BITSLICED_NUMBER_OF_LANES; ++i) {
+		
+			// Set lane's result from its row
+			results[i] = rows[i];
+		}
+	}
+	
+	// SipRound bitsliced
+	void sipRoundBitsliced(SipHash24BitslicedWord &v0, SipHash24BitslicedWord &v1, SipHash24BitslicedWord &v2, SipHash24BitslicedWord &v3) {
+	
+		// Perform SipRound on bitsliced words
+		addBitslicedWords(v0, v1);
+		addBitslicedWords(v2, v3);
+		rotateBitslicedWordLeft(v1, 13);
+		rotateBitslicedWordLeft(v3, 16);
+		exclusiveOrBitslicedWords(v1, v0);
+		exclusiveOrBitslicedWords(v3, v2);
+		rotateBitslicedWordLeft(v0, 32);
+		addBitslicedWords(v2, v1);
+		addBitslicedWords(v0, v3);
+		rotateBitslicedWordLeft(v1, 17);
+		rotateBitslicedWordLeft(v3, SIP_ROUND_ROTATION);
+		exclusiveOrBitslicedWords(v1, v2);
+		exclusiveOrBitslicedWords(v3, v0);
+		rotateBitslicedWordLeft(v2, 32);
+	}
+	
+	// Add bitsliced words
+	void addBitslicedWords(SipHash24BitslicedWord &word, const SipHash24BitslicedWord &otherWord) {
+	
+		// Go through all bits from least significant to most significant
+		uint64_t carry = 0;
+		for(size_t i = 0; i < sizeof(uint64_t) * BITS_IN_A_BYTE; ++i) {
+		
+			// Set bit's slice to the sum of the bit's slices and the carry and get the next carry
+			uint64_t &slice = word.slices[(i + word.offset) % (sizeof(uint64_t) * BITS_IN_A_BYTE)];
+			const uint64_t otherSlice = otherWord.slices[(i + otherWord.offset) % (sizeof(uint64_t) * BITS_IN_A_BYTE)];
+			const uint64_t difference = slice ^ otherSlice;
+			const uint64_t sum = difference ^ carry;
+			carry = (slice & otherSlice) | (carry & difference);
+			slice = sum;
+		}
+	}
+	
+	// Exclusive or bitsliced words
+	void exclusiveOrBitslicedWords(SipHash24BitslicedWord &word, const SipHash24BitslicedWord &otherWord) {
+	
+		// Go through all bits
+		for(size_t i = 0; i < sizeof(uint64_t) * BITS_IN_A_BYTE; ++i) {
+		
+			// Exclusive or bit's slice with the other word's bit's slice
+			word.slices[(i + word.offset) % (sizeof(uint64_t) * BITS_IN_A_BYTE)] ^= otherWord.slices[(i + otherWord.offset) % (sizeof(uint64_t) * BITS_IN_A_BYTE)];
+		}
+	}
+	
+	// Rotate bitsliced word left
+	void rotateBitslicedWordLeft(SipHash24BitslicedWord &word, const int shift) {
+	
+		// Rotate word left by shift by changing which slice is its least significant bit
+		word.offset = (word.offset + sizeof(uint64_t) * BITS_IN_A_BYTE - shift) % (sizeof(uint64_t) * BITS_IN_A_BYTE);
+	}
+	
+	// Transpose bit matrix
+	void transposeBitMatrix(uint64_t rows[sizeof(uint64_t) * BITS_IN_A_BYTE]) {
+	
+		// Go through all block sizes from half the matrix to single bits
+		uint64_t mask = UINT32_MAX;
+		for(size_t blockSize = sizeof(uint64_t) * BITS_IN_A_BYTE / 2; blockSize; blockSize /= 2, mask ^= mask << blockSize) {
+		
+			// Go through all pairs of rows whose blocks are swapped
+			for(size_t i = 0; i < sizeof(uint64_t) * BITS_IN_A_BYTE; i = (i + blockSize + 1) & ~blockSize) {
+			
+				// Swap the upper block of the first row with the lower block of the second row
+				const uint64_t swap = ((rows[i] >> blockSize) ^ rows[i + blockSize]) & mask;
+				rows[i] ^= swap << blockSize;
+				rows[i + blockSize] ^= swap;
+			}
+		}
+	}
+	
+	// Get SipHash-2-4 batch function
+	void (*getSipHash24BatchFunction())(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces) {
+	
+		// Check if using x86
+		#if defined(__x86_64__) || defined(__i386__)
+		
+			// Initialize CPU features
+			__builtin_cpu_init();
+			
+			// Check if CPU supports AVX-512
+			if(__builtin_cpu_supports("avx512f")) {
+			
+				// Return SipHash-2-4 AVX-512 batch
+				return sipHash24Avx512Batch;
+			}
+			
+			// Check if CPU supports AVX2
+			if(__builtin_cpu_supports("avx2")) {
+			
+				// Return SipHash-2-4 AVX2 batch
+				return sipHash24Avx2Batch;
+			}
+		#endif
+		
+		// Return the faster of the SipHash-2-4 bitsliced batch and the SipHash-2-4 scalar batch on this CPU
+		return (getSipHash24BatchFunctionDuration(sipHash24BitslicedBatch) < getSipHash24BatchFunctionDuration(sipHash24ScalarBatch)) ? sipHash24BitslicedBatch : sipHash24ScalarBatch;
+	}
+	
+	// Get SipHash-2-4 batch function duration
+	chrono::steady_clock::duration getSipHash24BatchFunctionDuration(void (*sipHash24BatchFunction)(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces)) {
+	
+		// Go through all calibration nonces
+		static uint32_t nonces[SIPHASH24_BATCH_CALIBRATION_NUMBER_OF_NONCES];
+		for(size_t i = 0; i < SIPHASH24_BATCH_CALIBRATION_NUMBER_OF_NONCES; ++i) {
+		
+			// Set nonce to an edge's node's nonce
+			nonces[i] = i * 2;
+		}
+		
+		// Go through all calibration runs
+		const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys = {};
+		static uint32_t results[SIPHASH24_BATCH_CALIBRATION_NUMBER_OF_NONCES];
+		chrono::steady_clock::duration duration = chrono::steady_clock::duration::max();
+		for(int i = 0; i < SIPHASH24_BATCH_CALIBRATION_NUMBER_OF_RUNS; ++i) {
+		
+			// Perform hashes on the calibration nonces using the SipHash-2-4 batch function
+			const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+			sipHash24BatchFunction(sipHashKeys, nonces, results, SIPHASH24_BATCH_CALIBRATION_NUMBER_OF_NONCES);
+			
+			// Update duration to the fastest run
+			duration = min(duration, chrono::steady_clock::now() - start);
+		}
+		
+		// Return duration
+		return duration;
+	}
+#endif
+
 
 #endif
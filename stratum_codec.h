@@ -0,0 +1,872 @@
+// Header guard
+#ifndef STRATUM_CODEC_H
+#define STRATUM_CODEC_H
+
+
+// Header files
+using namespace std;
+
+
+// Constants
+
+// Stratum codec max depth
+#define STRATUM_CODEC_MAX_DEPTH (sizeof(uint64_t) * BITS_IN_A_BYTE)
+
+// Stratum codec hex vector size
+#define STRATUM_CODEC_HEX_VECTOR_SIZE 16
+
+// Stratum codec digit pairs
+#define STRATUM_CODEC_DIGIT_PAIRS "00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899"
+
+
+// Enumerations
+
+// Stratum method
+enum class StratumMethod {
+
+	// None
+	NONE,
+	
+	// Login
+	LOGIN,
+	
+	// Get job template
+	GET_JOB_TEMPLATE,
+	
+	// Job
+	JOB,
+	
+	// Submit
+	SUBMIT,
+	
+	// Keepalive
+	KEEPALIVE,
+	
+	// Other
+	OTHER
+};
+
+// Stratum key
+enum class StratumKey {
+
+	// None
+	NONE,
+	
+	// ID
+	ID,
+	
+	// Method
+	METHOD,
+	
+	// Error
+	ERROR,
+	
+	// Code
+	CODE,
+	
+	// Height
+	HEIGHT,
+	
+	// Job ID
+	JOB_ID,
+	
+	// Pre-proof of work
+	PRE_PROOF_OF_WORK
+};
+
+
+// Structures
+
+// Stratum message structure
+struct StratumMessage {
+
+	// Has ID
+	bool hasId;
+	
+	// ID
+	uint64_t id;
+	
+	// Method
+	StratumMethod method;
+	
+	// Error is null
+	bool errorIsNull;
+	
+	// Has error code
+	bool hasErrorCode;
+	
+	// Error code
+	int64_t errorCode;
+	
+	// Has height
+	bool hasHeight;
+	
+	// Height
+	uint64_t height;
+	
+	// Has job ID
+	bool hasJobId;
+	
+	// Job ID
+	uint64_t jobId;
+	
+	// Has header
+	bool hasHeader;
+	
+	// Header
+	uint8_t header[HEADER_SIZE];
+};
+
+
+// Classes
+
+// Stratum hex vector
+typedef uint8_t __attribute__((vector_size(STRATUM_CODEC_HEX_VECTOR_SIZE))) StratumHexVector;
+
+// Stratum line buffer class
+class StratumLineBuffer final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit StratumLineBuffer();
+		
+		// Clear
+		ITCM_CODE inline void clear();
+		
+		// Get free space
+		ITCM_CODE inline char *getFreeSpace(size_t &size);
+		
+		// Commit
+		ITCM_CODE inline void commit(const size_t size);
+		
+		// Get lines
+		ITCM_CODE inline bool getLines(const char *&lines, size_t &size);
+	
+	// Private
+	private:
+	
+		// Data
+		char data[STRATUM_SERVER_RESPONSE_BUFFER_SIZE];
+		
+		// Read index
+		size_t readIndex;
+		
+		// Scanned index
+		size_t scannedIndex;
+		
+		// Write index
+		size_t writeIndex;
+};
+
+
+// Function prototypes
+
+// Parse stratum message
+ITCM_CODE static inline bool parseStratumMessage(const char *line, const size_t size, StratumMessage &message);
+
+// Get stratum key
+ITCM_CODE static inline StratumKey getStratumKey(const char *start, const char *end);
+
+// Get stratum method
+ITCM_CODE static inline StratumMethod getStratumMethod(const char *start, const char *end);
+
+// Parse stratum number
+ITCM_CODE static inline bool parseStratumNumber(const char *start, const char *end, uint64_t &number);
+
+// Parse stratum signed number
+ITCM_CODE static inline bool parseStratumSignedNumber(const char *start, const char *end, int64_t &number);
+
+// Decode stratum hex
+ITCM_CODE static inline bool decodeStratumHex(const char *hex, uint8_t *data, const size_t size);
+
+// Write stratum string
+template<size_t size> [[gnu::always_inline]] static inline char *writeStratumString(char *destination, const char (&string)[size]);
+
+// Write stratum number
+template<typename NumberType> ITCM_CODE static inline char *writeStratumNumber(char *destination, NumberType number);
+
+// Write stratum submit request
+ITCM_CODE static inline size_t writeStratumSubmitRequest(char request[SUBMIT_REQUEST_SIZE], const uint32_t requestId, const uint64_t height, const uint64_t jobId, const uint64_t nonce, const uint32_t solution[SOLUTION_SIZE]);
+
+
+// Supporting function implementation
+
+// Constructor
+StratumLineBuffer::StratumLineBuffer() :
+
+	// Set read index to zero
+	readIndex(0),
+	
+	// Set scanned index to zero
+	scannedIndex(0),
+	
+	// Set write index to zero
+	writeIndex(0)
+{
+}
+
+// Clear
+void StratumLineBuffer::clear() {
+
+	// Set that the buffer is empty
+	readIndex = 0;
+	scannedIndex = 0;
+	writeIndex = 0;
+}
+
+// Get free space
+char *StratumLineBuffer::getFreeSpace(size_t &size) {
+
+	// Check if all data was read
+	if(readIndex == writeIndex) {
+	
+		// Start writing at the beginning of the buffer
+		clear();
+	}
+	
+	// Otherwise check if the buffer's end is reached and data was read from its beginning
+	else if(writeIndex == sizeof(data) && readIndex) {
+	
+		// Move the unread data to the beginning of the buffer so that lines stay contiguous
+		memmove(data, &data[readIndex], writeIndex - readIndex);
+		scannedIndex -= readIndex;
+		writeIndex -= readIndex;
+		readIndex = 0;
+	}
+	
+	// Return free space
+	size = sizeof(data) - writeIndex;
+	return &data[writeIndex];
+}
+
+// Commit
+void StratumLineBuffer::commit(const size_t size) {
+
+	// Include size in the written data
+	writeIndex += size;
+}
+
+// Get lines
+bool StratumLineBuffer::getLines(const char *&lines, size_t &size) {
+
+	// Go through all newlines in the data that wasn't scanned
+	const char *lastNewline = nullptr;
+	for(const char *newline = static_cast<const char *>(memchr(&data[scannedIndex], '\n', writeIndex - scannedIndex)); newline; newline = static_cast<const char *>(memchr(&newline[sizeof('\n')], '\n', &data[writeIndex] - &newline[sizeof('\n')]))) {
+	
+		// Set last newline to the newline
+		lastNewline = newline;
+	}
+	
+	// Set that all data was scanned
+	scannedIndex = writeIndex;
+	
+	// Check if no complete lines exist
+	if(!lastNewline) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Get complete lines and set that they were read
+	lines = &data[readIndex];
+	size = &lastNewline[sizeof('\n')] - lines;
+	readIndex += size;
+	
+	// Return true
+	return true;
+}
+
+// Parse stratum message
+bool parseStratumMessage(const char *line, const size_t size, StratumMessage &message) {
+
+	// Reset message
+	message.hasId = false;
+	message.method = StratumMethod::NONE;
+	message.errorIsNull = false;
+	message.hasErrorCode = false;
+	message.hasHeight = false;
+	message.hasJobId = false;
+	message.hasHeader = false;
+	
+	// Go through all of the line's tokens
+	uint64_t objectContainers = 0;
+	size_t depth = 0;
+	size_t errorDepth = 0;
+	bool expectingKey = false;
+	StratumKey key = StratumKey::NONE;
+	for(const char *i = line, *end = &line[size]; i != end;) {
+	
+		// Check token
+		switch(*i) {
+		
+			// Whitespace
+			case ' ':
+			case '\t':
+			case '\r':
+			case '\n':
+			
+				// Go to next character
+				++i;
+				
+				// Break
+				break;
+			
+			// Object or array start
+			case '{':
+			case '[':
+			
+				// Check if too deep
+				if(depth == STRATUM_CODEC_MAX_DEPTH) {
+				
+					// Return false
+					return false;
+				}
+				
+				// Set if the container is an object
+				objectContainers = (objectContainers & ~(static_cast<uint64_t>(1) << depth)) | (static_cast<uint64_t>(*i == '{') << depth);
+				++depth;
+				
+				// Check if container is the error
+				if(key == StratumKey::ERROR) {
+				
+					// Set error depth
+					errorDepth = depth;
+				}
+				
+				// Set that a key is expected if the container is an object
+				expectingKey = *i == '{';
+				key = StratumKey::NONE;
+				
+				// Go to next character
+				++i;
+				
+				// Break
+				break;
+			
+			// Object or array end
+			case '}':
+			case ']':
+			
+				// Check if container doesn't exist or is a different type
+				if(!depth || static_cast<bool>((objectContainers >> (depth - 1)) & 1) != (*i == '}')) {
+				
+					// Return false
+					return false;
+				}
+				
+				// Check if leaving the error
+				if(depth == errorDepth) {
+				
+					// Reset error depth
+					errorDepth = 0;
+				}
+				
+				// Leave container
+				--depth;
+				expectingKey = false;
+				key = StratumKey::NONE;
+				
+				// Go to next character
+				++i;
+				
+				// Break
+				break;
+			
+			// Value separator
+			case ',':
+			
+				// Set that a key is expected if in an object
+				expectingKey = depth && ((objectContainers >> (depth - 1)) & 1);
+				key = StratumKey::NONE;
+				
+				// Go to next character
+				++i;
+				
+				// Break
+				break;
+			
+			// Key separator
+			case ':':
+			
+				// Go to next character
+				++i;
+				
+				// Break
+				break;
+			
+			// String
+			case '"': {
+			
+				// Go through all of the string's characters
+				const char *stringStart = &i[sizeof('"')];
+				const char *stringEnd = stringStart;
+				while(stringEnd != end && *stringEnd != '"') {
+				
+					// Skip escaped character
+					stringEnd += (*stringEnd == '\\' && &stringEnd[sizeof('\\')] != end) ? 2 : 1;
+				}
+				
+				// Check if string isn't terminated
+				if(stringEnd == end) {
+				
+					// Return false
+					return false;
+				}
+				
+				// Check if string is a key
+				if(expectingKey) {
+				
+					// Set key
+					key = getStratumKey(stringStart, stringEnd);
+					expectingKey = false;
+					
+					// Check if key is an ID that isn't the message's or a code that isn't the error's
+					if((key == StratumKey::ID && depth != 1) || (key == StratumKey::CODE && (!errorDepth || depth != errorDepth))) {
+					
+						// Ignore key
+						key = StratumKey::NONE;
+					}
+				}
+				
+				// Otherwise check if string is the ID
+				else if(key == StratumKey::ID) {
+				
+					// Set has ID to if parsing the ID was successful
+					message.hasId = parseStratumNumber(stringStart, stringEnd, message.id);
+				}
+				
+				// Otherwise check if string is the method
+				else if(key == StratumKey::METHOD) {
+				
+					// Set method
+					message.method = getStratumMethod(stringStart, stringEnd);
+				}
+				
+				// Otherwise check if string is the pre-proof of work
+				else if(key == StratumKey::PRE_PROOF_OF_WORK) {
+				
+					// Set has header to if decoding the pre-proof of work as the header was successful
+					message.hasHeader = stringEnd - stringStart == sizeof(message.header) * 2 && decodeStratumHex(stringStart, message.header, sizeof(message.header));
+				}
+				
+				// Go to after the string
+				i = &stringEnd[sizeof('"')];
+				
+				// Break
+				break;
+			}
+			
+			// Number, boolean, or null
+			default: {
+			
+				// Go through all of the value's characters
+				const char *valueStart = i;
+				while(i != end && *i != ',' && *i != '}' && *i != ']' && *i != ' ' && *i != '\t' && *i != '\r' && *i != '\n') {
+				
+					// Go to next character
+					++i;
+				}
+				
+				// Check key
+				switch(key) {
+				
+					// ID
+					case StratumKey::ID:
+					
+						// Set has ID to if parsing the ID was successful
+						message.hasId = parseStratumNumber(valueStart, i, message.id);
+						
+						// Break
+						break;
+					
+					// Error
+					case StratumKey::ERROR:
+					
+						// Set error is null
+						message.errorIsNull = i - valueStart == sizeof("null") - sizeof('\0') && !memcmp(valueStart, "null", sizeof("null") - sizeof('\0'));
+						
+						// Break
+						break;
+					
+					// Code
+					case StratumKey::CODE:
+					
+						// Set has error code to if parsing the error code was successful
+						message.hasErrorCode = parseStratumSignedNumber(valueStart, i, message.errorCode);
+						
+						// Break
+						break;
+					
+					// Height
+					case StratumKey::HEIGHT:
+					
+						// Set has height to if parsing the height was successful
+						message.hasHeight = parseStratumNumber(valueStart, i, message.height);
+						
+						// Break
+						break;
+					
+					// Job ID
+					case StratumKey::JOB_ID:
+					
+						// Set has job ID to if parsing the job ID was successful
+						message.hasJobId = parseStratumNumber(valueStart, i, message.jobId);
+						
+						// Break
+						break;
+					
+					// Default
+					default:
+					
+						// Break
+						break;
+				}
+				
+				// Break
+				break;
+			}
+		}
+	}
+	
+	// Return if all containers ended
+	return !depth;
+}
+
+// Get stratum key
+StratumKey getStratumKey(const char *start, const char *end) {
+
+	// Check key's size
+	switch(end - start) {
+	
+		// ID
+		case sizeof("id") - sizeof('\0'):
+		
+			// Check if key is ID
+			if(!memcmp(start, "id", sizeof("id") - sizeof('\0'))) {
+			
+				// Return ID
+				return StratumKey::ID;
+			}
+			
+			// Break
+			break;
+		
+		// Code
+		case sizeof("code") - sizeof('\0'):
+		
+			// Check if key is code
+			if(!memcmp(start, "code", sizeof("code") - sizeof('\0'))) {
+			
+				// Return code
+				return StratumKey::CODE;
+			}
+			
+			// Break
+			break;
+		
+		// Pre-proof of work
+		case sizeof("pre_pow") - sizeof('\0'):
+		
+			// Check if key is pre-proof of work
+			if(!memcmp(start, "pre_pow", sizeof("pre_pow") - sizeof('\0'))) {
+			
+				// Return pre-proof of work
+				return StratumKey::PRE_PROOF_OF_WORK;
+			}
+			
+			// Break
+			break;
+		
+		// Error
+		case sizeof("error") - sizeof('\0'):
+		
+			// Check if key is error
+			if(!memcmp(start, "error", sizeof("error") - sizeof('\0'))) {
+			
+				// Return error
+				return StratumKey::ERROR;
+			}
+			
+			// Break
+			break;
+		
+		// Method, height, or job ID
+		case sizeof("method") - sizeof('\0'):
+		
+			// Check if key is method
+			if(!memcmp(start, "method", sizeof("method") - sizeof('\0'))) {
+			
+				// Return method
+				return StratumKey::METHOD;
+			}
+			
+			// Check if key is height
+			if(!memcmp(start, "height", sizeof("height") - sizeof('\0'))) {
+			
+				// Return height
+				return StratumKey::HEIGHT;
+			}
+			
+			// Check if key is job ID
+			if(!memcmp(start, "job_id", sizeof("job_id") - sizeof('\0'))) {
+			
+				// Return job ID
+				return StratumKey::JOB_ID;
+			}
+			
+			// Break
+			break;
+	}
+	
+	// Return none
+	return StratumKey::NONE;
+}
+
+// Get stratum method
+StratumMethod getStratumMethod(const char *start, const char *end) {
+
+	// Check if method is job
+	if(end - start == sizeof("job") - sizeof('\0') && !memcmp(start, "job", sizeof("job") - sizeof('\0'))) {
+	
+		// Return job
+		return StratumMethod::JOB;
+	}
+	
+	// Check if method is get job template
+	if(end - start == sizeof("getjobtemplate") - sizeof('\0') && !memcmp(start, "getjobtemplate", sizeof("getjobtemplate") - sizeof('\0'))) {
+	
+		// Return get job template
+		return StratumMethod::GET_JOB_TEMPLATE;
+	}
+	
+	// Check if method is submit
+	if(end - start == sizeof("submit") - sizeof('\0') && !memcmp(start, "submit", sizeof("submit") - sizeof('\0'))) {
+	
+		// Return submit
+		return StratumMethod::SUBMIT;
+	}
+	
+	// Check if method is keepalive
+	if(end - start == sizeof("keepalive") - sizeof('\0') && !memcmp(start, "keepalive", sizeof("keepalive") - sizeof('\0'))) {
+	
+		// Return keepalive
+		return StratumMethod::KEEPALIVE;
+	}
+	
+	// Check if method is login
+	if(end - start == sizeof("login") - sizeof('\0') && !memcmp(start, "login", sizeof("login") - sizeof('\0'))) {
+	
+		// Return login
+		return StratumMethod::LOGIN;
+	}
+	
+	// Return other
+	return StratumMethod::OTHER;
+}
+
+// Parse stratum number
+bool parseStratumNumber(const char *start, const char *end, uint64_t &number) {
+
+	// Check if number is empty or has a leading zero
+	if(start == end || (*start == '0' && end - start != 1)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Go through all of the number's digits
+	number = 0;
+	for(const char *i = start; i != end; ++i) {
+	
+		// Check if character isn't a digit or the number would overflow
+		if(*i < '0' || *i > '9' || number > (UINT64_MAX - (*i - '0')) / 10) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Include digit in the number
+		number = number * 10 + (*i - '0');
+	}
+	
+	// Return true
+	return true;
+}
+
+// Parse stratum signed number
+bool parseStratumSignedNumber(const char *start, const char *end, int64_t &number) {
+
+	// Check if parsing the number's magnitude failed or it's out of range
+	const bool isNegative = start != end && *start == '-';
+	uint64_t magnitude;
+	if(!parseStratumNumber(&start[isNegative], end, magnitude) || magnitude > static_cast<uint64_t>(INT64_MAX) + isNegative) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Set number to the magnitude with its sign
+	number = isNegative ? static_cast<int64_t>(-magnitude) : static_cast<int64_t>(magnitude);
+	
+	// Return true
+	return true;
+}
+
+// Decode stratum hex
+bool decodeStratumHex(const char *hex, uint8_t *data, const size_t size) {
+
+	// Go through all groups of hex characters that fill a vector
+	size_t i = 0;
+	for(; i + STRATUM_CODEC_HEX_VECTOR_SIZE / 2 <= size; i += STRATUM_CODEC_HEX_VECTOR_SIZE / 2) {
+	
+		// Get the group's hex characters
+		StratumHexVector characters;
+		memcpy(&characters, &hex[i * 2], sizeof(characters));
+		
+		// Check if any of the characters aren't lowercase hex characters
+		const StratumHexVector digits = characters - '0';
+		const StratumHexVector letters = characters - 'a';
+		const StratumHexVector areDigits = reinterpret_cast<StratumHexVector>(digits <= 9);
+		const StratumHexVector areLetters = reinterpret_cast<StratumHexVector>(letters <= 'f' - 'a');
+		const StratumHexVector areValid = areDigits | areLetters;
+		uint64_t validWords[sizeof(areValid) / sizeof(uint64_t)];
+		memcpy(validWords, &areValid, sizeof(areValid));
+		for(size_t j = 0; j < sizeof(validWords) / sizeof(validWords[0]); ++j) {
+		
+			// Check if word has an invalid character
+			if(validWords[j] != UINT64_MAX) {
+			
+				// Return false
+				return false;
+			}
+		}
+		
+		// Get the characters' values
+		const StratumHexVector values = (digits & areDigits) | ((letters + 10) & areLetters);
+		
+		// Go through all pairs of values
+		for(size_t j = 0; j < STRATUM_CODEC_HEX_VECTOR_SIZE / 2; ++j) {
+		
+			// Set byte in the data to the pair of values
+			data[i + j] = (values[j * 2] << 4) | values[j * 2 + 1];
+		}
+	}
+	
+	// Go through all remaining bytes
+	for(; i < size; ++i) {
+	
+		// Go through both of the byte's hex characters
+		uint8_t byte = 0;
+		for(size_t j = 0; j < 2; ++j) {
+		
+			// Check if character is a digit
+			const char character = hex[i * 2 + j];
+			if(character >= '0' && character <= '9') {
+			
+				// Include digit in the byte
+				byte = (byte << 4) | (character - '0');
+			}
+			
+			// Otherwise check if character is a lowercase hex letter
+			else if(character >= 'a' && character <= 'f') {
+			
+				// Include letter in the byte
+				byte = (byte << 4) | (character - 'a' + 10);
+			}
+			
+			// Otherwise
+			else {
+			
+				// Return false
+				return false;
+			}
+		}
+		
+		// Set byte in the data
+		data[i] = byte;
+	}
+	
+	// Return true
+	return true;
+}
+
+// Write stratum string
+template<size_t size> char *writeStratumString(char *destination, const char (&string)[size]) {
+
+	// Copy string without its null terminator to the destination
+	memcpy(destination, string, size - sizeof('\0'));
+	
+	// Return end of the string in the destination
+	return &destination[size - sizeof('\0')];
+}
+
+// Write stratum number
+template<typename NumberType> char *writeStratumNumber(char *destination, NumberType number) {
+
+	// Go through all pairs of the number's digits starting with the least significant pair
+	char digits[sizeof("18446744073709551615") - sizeof('\0')];
+	char *start = &digits[sizeof(digits)];
+	while(number >= 100) {
+	
+		// Prepend pair of digits
+		const unsigned int pair = number % 100;
+		number /= 100;
+		start -= 2;
+		memcpy(start, &STRATUM_CODEC_DIGIT_PAIRS[pair * 2], 2);
+	}
+	
+	// Check if number has two remaining digits
+	if(number >= 10) {
+	
+		// Prepend pair of digits
+		start -= 2;
+		memcpy(start, &STRATUM_CODEC_DIGIT_PAIRS[number * 2], 2);
+	}
+	
+	// Otherwise
+	else {
+	
+		// Prepend digit
+		*--start = '0' + number;
+	}
+	
+	// Copy digits to the destination
+	memcpy(destination, start, &digits[sizeof(digits)] - start);
+	
+	// Return end of the digits in the destination
+	return &destination[&digits[sizeof(digits)] - start];
+}
+
+// Write stratum submit request
+size_t writeStratumSubmitRequest(char request[SUBMIT_REQUEST_SIZE], const uint32_t requestId, const uint64_t height, const uint64_t jobId, const uint64_t nonce, const uint32_t solution[SOLUTION_SIZE]) {
+
+	// Write request's ID, start, height, job ID, and nonce
+	char *end = writeStratumString(request, "{\"id\":\"");
+	end = writeStratumNumber(end, requestId);
+	end = writeStratumString(end, "\",\"jsonrpc\":\"2.0\",\"method\":\"submit\",\"params\":{\"edge_bits\":" TO_STRING(EDGE_BITS) ",\"height\":");
+	end = writeStratumNumber(end, height);
+	end = writeStratumString(end, ",\"job_id\":");
+	end = writeStratumNumber(end, jobId);
+	end = writeStratumString(end, ",\"nonce\":");
+	end = writeStratumNumber(end, nonce);
+	end = writeStratumString(end, ",\"pow\":[");
+	
+	// Go through all of the solution's edges
+	for(int i = 0; i < SOLUTION_SIZE; ++i) {
+	
+		// Write edge's index
+		end = writeStratumNumber(end, solution[i]);
+		*end++ = (i == SOLUTION_SIZE - 1) ? ']' : ',';
+	}
+	
+	// Write request's end
+	end = writeStratumString(end, "}}\n");
+	
+	// Return request's size
+	return end - request;
+}
+
+
+#endif
@@ -0,0 +1,325 @@
+// Header guard
+#ifndef STRATUM_MAILBOX_H
+#define STRATUM_MAILBOX_H
+
+
+// Header files
+using namespace std;
+
+
+// Constants
+
+// Check if using Linux
+#ifdef __linux__
+
+	// Stratum job mailbox fence
+	#define STRATUM_JOB_MAILBOX_FENCE __atomic_thread_fence
+	
+	// Stratum submission queue capacity
+	#define STRATUM_SUBMISSION_QUEUE_CAPACITY (MAX_NUMBER_OF_SOLUTIONS * 2)
+
+// Otherwise
+#else
+
+	// Stratum job mailbox fence
+	#define STRATUM_JOB_MAILBOX_FENCE __atomic_signal_fence
+#endif
+
+
+// Structures
+
+// Stratum job structure
+struct StratumJob {
+
+	// Height
+	uint64_t height;
+	
+	// ID
+	uint64_t id;
+	
+	// Header
+	uint8_t header[HEADER_SIZE];
+};
+
+
+// Classes
+
+// Stratum job mailbox class
+class StratumJobMailbox final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit StratumJobMailbox();
+		
+		// Publish
+		ITCM_CODE inline void publish(const StratumJob &job);
+		
+		// Receive
+		ITCM_CODE inline bool receive(StratumJob &job);
+		
+		// Peek
+		ITCM_CODE inline bool peek(StratumJob &job) const;
+	
+	// Private
+	private:
+	
+		// Read
+		ITCM_CODE inline bool read(StratumJob &job, uint32_t &jobSequence) const;
+		
+		// Sequence
+		uint32_t sequence;
+		
+		// Received sequence
+		uint32_t receivedSequence;
+		
+		// Job words
+		uint32_t jobWords[(sizeof(StratumJob) + sizeof(uint32_t) - 1) / sizeof(uint32_t)];
+};
+
+// Check if using Linux
+#ifdef __linux__
+
+	// Stratum submission queue class
+	class StratumSubmissionQueue final {
+	
+		// Public
+		public:
+		
+			// Constructor
+			inline explicit StratumSubmissionQueue();
+			
+			// Push
+			inline bool push(const uint32_t requestId, const uint64_t height, const char *request, const size_t size);
+			
+			// Peek
+			inline bool peek(uint32_t &requestId, uint64_t &height, char request[SUBMIT_REQUEST_SIZE], size_t &size) const;
+			
+			// Pop
+			inline void pop();
+			
+			// Get size
+			inline size_t getSize() const;
+		
+		// Private
+		private:
+		
+			// Entry structure
+			struct Entry {
+			
+				// Request ID
+				uint32_t requestId;
+				
+				// Height
+				uint64_t height;
+				
+				// Size
+				size_t size;
+				
+				// Request
+				char request[SUBMIT_REQUEST_SIZE];
+			};
+			
+			// Entries
+			Entry entries[STRATUM_SUBMISSION_QUEUE_CAPACITY];
+			
+			// Head
+			uint32_t head;
+			
+			// Tail
+			uint32_t tail;
+	};
+#endif
+
+
+// Supporting function implementation
+
+// Constructor
+StratumJobMailbox::StratumJobMailbox() :
+
+	// Set sequence to zero
+	sequence(0),
+	
+	// Set received sequence to zero
+	receivedSequence(0),
+	
+	// Clear job words
+	jobWords()
+{
+}
+
+// Publish
+void StratumJobMailbox::publish(const StratumJob &job) {
+
+	// Get job as words
+	uint32_t words[sizeof(jobWords) / sizeof(jobWords[0])] = {};
+	memcpy(words, &job, sizeof(job));
+	
+	// Set that the job is being written
+	const uint32_t currentSequence = __atomic_load_n(&sequence, __ATOMIC_RELAXED);
+	__atomic_store_n(&sequence, currentSequence + 1, __ATOMIC_RELAXED);
+	STRATUM_JOB_MAILBOX_FENCE(__ATOMIC_RELEASE);
+	
+	// Go through all of the job's words
+	for(size_t i = 0; i < sizeof(jobWords) / sizeof(jobWords[0]); ++i) {
+	
+		// Set job word
+		__atomic_store_n(&jobWords[i], words[i], __ATOMIC_RELAXED);
+	}
+	
+	// Set that the job was written
+	STRATUM_JOB_MAILBOX_FENCE(__ATOMIC_RELEASE);
+	__atomic_store_n(&sequence, currentSequence + 2, __ATOMIC_RELAXED);
+}
+
+// Receive
+bool StratumJobMailbox::receive(StratumJob &job) {
+
+	// Check if no job was published since the last received job
+	uint32_t jobSequence;
+	if(!read(job, jobSequence)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Set received sequence
+	receivedSequence = jobSequence;
+	
+	// Return true
+	return true;
+}
+
+// Peek
+bool StratumJobMailbox::peek(StratumJob &job) const {
+
+	// Return if a job was published since the last received job without receiving it
+	uint32_t jobSequence;
+	return read(job, jobSequence);
+}
+
+// Read
+bool StratumJobMailbox::read(StratumJob &job, uint32_t &jobSequence) const {
+
+	// Loop until a job that wasn't being written is read
+	uint32_t words[sizeof(jobWords) / sizeof(jobWords[0])];
+	uint32_t startingSequence;
+	do {
+	
+		// Check if no job was published since the last received job
+		startingSequence = __atomic_load_n(&sequence, __ATOMIC_RELAXED);
+		STRATUM_JOB_MAILBOX_FENCE(__ATOMIC_ACQUIRE);
+		if(startingSequence == receivedSequence) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Check if the job is being written
+		if(startingSequence % 2) {
+		
+			// Continue
+			continue;
+		}
+		
+		// Go through all of the job's words
+		for(size_t i = 0; i < sizeof(jobWords) / sizeof(jobWords[0]); ++i) {
+		
+			// Get job word
+			words[i] = __atomic_load_n(&jobWords[i], __ATOMIC_RELAXED);
+		}
+		
+		// Make sure the job's words are read before the sequence is checked again
+		STRATUM_JOB_MAILBOX_FENCE(__ATOMIC_ACQUIRE);
+	
+	} while(startingSequence % 2 || __atomic_load_n(&sequence, __ATOMIC_RELAXED) != startingSequence);
+	
+	// Get job from words
+	memcpy(&job, words, sizeof(job));
+	
+	// Set job sequence
+	jobSequence = startingSequence;
+	
+	// Return true
+	return true;
+}
+
+// Check if using Linux
+#ifdef __linux__
+
+	// Constructor
+	StratumSubmissionQueue::StratumSubmissionQueue() :
+	
+		// Set head to zero
+		head(0),
+		
+		// Set tail to zero
+		tail(0)
+	{
+	}
+	
+	// Push
+	bool StratumSubmissionQueue::push(const uint32_t requestId, const uint64_t height, const char *request, const size_t size) {
+	
+		// Check if queue is full or request is too large
+		const uint32_t currentTail = __atomic_load_n(&tail, __ATOMIC_RELAXED);
+		if(currentTail - __atomic_load_n(&head, __ATOMIC_ACQUIRE) == STRATUM_SUBMISSION_QUEUE_CAPACITY || size > sizeof(entries[0].request)) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Set entry at the tail to the request
+		Entry &entry = entries[currentTail % STRATUM_SUBMISSION_QUEUE_CAPACITY];
+		entry.requestId = requestId;
+		entry.height = height;
+		memcpy(entry.request, request, size);
+		entry.size = size;
+		
+		// Make entry available to the consumer
+		__atomic_store_n(&tail, currentTail + 1, __ATOMIC_RELEASE);
+		
+		// Return true
+		return true;
+	}
+	
+	// Peek
+	bool StratumSubmissionQueue::peek(uint32_t &requestId, uint64_t &height, char request[SUBMIT_REQUEST_SIZE], size_t &size) const {
+	
+		// Check if queue is empty
+		const uint32_t currentHead = __atomic_load_n(&head, __ATOMIC_RELAXED);
+		if(currentHead == __atomic_load_n(&tail, __ATOMIC_ACQUIRE)) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Get request from entry at the head without removing it so that it can be sent again if sending it fails
+		const Entry &entry = entries[currentHead % STRATUM_SUBMISSION_QUEUE_CAPACITY];
+		requestId = entry.requestId;
+		height = entry.height;
+		memcpy(request, entry.request, entry.size);
+		size = entry.size;
+		
+		// Return true
+		return true;
+	}
+	
+	// Pop
+	void StratumSubmissionQueue::pop() {
+	
+		// Make entry at the head available to the producer
+		__atomic_store_n(&head, __atomic_load_n(&head, __ATOMIC_RELAXED) + 1, __ATOMIC_RELEASE);
+	}
+	
+	// Get size
+	size_t StratumSubmissionQueue::getSize() const {
+	
+		// Return number of entries between the head and the tail
+		return __atomic_load_n(&tail, __ATOMIC_ACQUIRE) - __atomic_load_n(&head, __ATOMIC_RELAXED);
+	}
+#endif
+
+
+#endif
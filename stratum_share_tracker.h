@@ -0,0 +1,205 @@
+// Header guard
+#ifndef STRATUM_SHARE_TRACKER_H
+#define STRATUM_SHARE_TRACKER_H
+
+
+// Header files
+using namespace std;
+
+
+// Constants
+
+// Stratum share tracker capacity
+#define STRATUM_SHARE_TRACKER_CAPACITY (MAX_NUMBER_OF_SOLUTIONS * 4)
+
+
+// Enumerations
+
+// Stratum share result
+enum class StratumShareResult {
+
+	// Accepted
+	ACCEPTED,
+	
+	// Rejected
+	REJECTED,
+	
+	// Stale
+	STALE
+};
+
+
+// Structures
+
+// Stratum share statistics structure
+struct StratumShareStatistics {
+
+	// Number of accepted shares
+	uint32_t numberOfAcceptedShares;
+	
+	// Number of rejected shares
+	uint32_t numberOfRejectedShares;
+	
+	// Number of stale shares
+	uint32_t numberOfStaleShares;
+	
+	// Total latency milliseconds
+	uint32_t totalLatencyMilliseconds;
+};
+
+
+// Classes
+
+// Stratum share tracker class
+class StratumShareTracker final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit StratumShareTracker();
+		
+		// Clear pending shares
+		ITCM_CODE inline void clearPendingShares();
+		
+		// Add pending share
+		ITCM_CODE inline void addPendingShare(const uint32_t requestId, const uint32_t submitTime);
+		
+		// Resolve pending share
+		ITCM_CODE inline bool resolvePendingShare(const uint64_t requestId, const StratumShareResult result, const uint32_t responseTime);
+		
+		// Get statistics
+		ITCM_CODE inline void getStatistics(StratumShareStatistics &statistics) const;
+	
+	// Private
+	private:
+	
+		// Pending share structure
+		struct PendingShare {
+		
+			// Request ID
+			uint32_t requestId;
+			
+			// Submit time
+			uint32_t submitTime;
+			
+			// Is pending
+			bool isPending;
+		};
+		
+		// Increment statistic
+		ITCM_CODE static inline void incrementStatistic(uint32_t &statistic, const uint32_t amount);
+		
+		// Pending shares
+		PendingShare pendingShares[STRATUM_SHARE_TRACKER_CAPACITY];
+		
+		// Current statistics
+		StratumShareStatistics currentStatistics;
+};
+
+
+// Supporting function implementation
+
+// Constructor
+StratumShareTracker::StratumShareTracker() :
+
+	// Clear pending shares
+	pendingShares(),
+	
+	// Clear current statistics
+	currentStatistics()
+{
+}
+
+// Clear pending shares
+void StratumShareTracker::clearPendingShares() {
+
+	// Go through all pending shares
+	for(size_t i = 0; i < STRATUM_SHARE_TRACKER_CAPACITY; ++i) {
+	
+		// Set that share isn't pending
+		pendingShares[i].isPending = false;
+	}
+}
+
+// Add pending share
+void StratumShareTracker::addPendingShare(const uint32_t requestId, const uint32_t submitTime) {
+
+	// Set the request ID's slot to the share, replacing any older share in it that was never answered
+	PendingShare &pendingShare = pendingShares[requestId % STRATUM_SHARE_TRACKER_CAPACITY];
+	pendingShare.requestId = requestId;
+	pendingShare.submitTime = submitTime;
+	pendingShare.isPending = true;
+}
+
+// Resolve pending share
+bool StratumShareTracker::resolvePendingShare(const uint64_t requestId, const StratumShareResult result, const uint32_t responseTime) {
+
+	// Check if share isn't pending
+	PendingShare &pendingShare = pendingShares[requestId % STRATUM_SHARE_TRACKER_CAPACITY];
+	if(!pendingShare.isPending || pendingShare.requestId != requestId) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Set that share isn't pending
+	pendingShare.isPending = false;
+	
+	// Include share's latency in the statistics
+	incrementStatistic(currentStatistics.totalLatencyMilliseconds, responseTime - pendingShare.submitTime);
+	
+	// Check result
+	switch(result) {
+	
+		// Accepted
+		case StratumShareResult::ACCEPTED:
+		
+			// Increment number of accepted shares
+			incrementStatistic(currentStatistics.numberOfAcceptedShares, 1);
+			
+			// Break
+			break;
+		
+		// Rejected
+		case StratumShareResult::REJECTED:
+		
+			// Increment number of rejected shares
+			incrementStatistic(currentStatistics.numberOfRejectedShares, 1);
+			
+			// Break
+			break;
+		
+		// Stale
+		case StratumShareResult::STALE:
+		
+			// Increment number of stale shares
+			incrementStatistic(currentStatistics.numberOfStaleShares, 1);
+			
+			// Break
+			break;
+	}
+	
+	// Return true
+	return true;
+}
+
+// Get statistics
+void StratumShareTracker::getStatistics(StratumShareStatistics &statistics) const {
+
+	// Get statistics
+	statistics.numberOfAcceptedShares = __atomic_load_n(&currentStatistics.numberOfAcceptedShares, __ATOMIC_RELAXED);
+	statistics.numberOfRejectedShares = __atomic_load_n(&currentStatistics.numberOfRejectedShares, __ATOMIC_RELAXED);
+	statistics.numberOfStaleShares = __atomic_load_n(&currentStatistics.numberOfStaleShares, __ATOMIC_RELAXED);
+	statistics.totalLatencyMilliseconds = __atomic_load_n(&currentStatistics.totalLatencyMilliseconds, __ATOMIC_RELAXED);
+}
+
+// Increment statistic
+void StratumShareTracker::incrementStatistic(uint32_t &statistic, const uint32_t amount) {
+
+	// Increment statistic without a read-modify-write since only one thread updates it
+	__atomic_store_n(&statistic, __atomic_load_n(&statistic, __ATOMIC_RELAXED) + amount, __ATOMIC_RELAXED);
+}
+
+
+#endif
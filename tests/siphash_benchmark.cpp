@@ -0,0 +1,155 @@
+// Constants
+
+// Number of nonces
+#define NUMBER_OF_NONCES (1 << 16)
+
+// Number of runs
+#define NUMBER_OF_RUNS 64
+
+// Number of SipHash-2-4 batch kernels
+#define NUMBER_OF_SIPHASH24_BATCH_KERNELS (sizeof(sipHash24BatchKernels) / sizeof(sipHash24BatchKernels[0]))
+
+
+// Header files
+
+// Rename the miner's main function so that the benchmark can provide its own
+#define main minerMain
+#include "../main.cpp"
+#undef main
+
+
+// Structures
+
+// SipHash-2-4 batch kernel structure
+struct SipHash24BatchKernel {
+
+	// Name
+	const char *name;
+	
+	// Function
+	void (*function)(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces);
+	
+	// CPU feature
+	const char *cpuFeature;
+};
+
+
+// Global variables
+
+// SipHash-2-4 batch kernels
+static const SipHash24BatchKernel sipHash24BatchKernels[] = {
+
+	// SipHash-2-4 scalar batch
+	{"scalar", sipHash24ScalarBatch, nullptr},
+	
+	// Check if using x86
+	#if defined(__x86_64__) || defined(__i386__)
+	
+		// SipHash-2-4 AVX2 batch
+		{"AVX2", sipHash24Avx2Batch, "avx2"},
+		
+		// SipHash-2-4 AVX-512 batch
+		{"AVX-512", sipHash24Avx512Batch, "avx512f"},
+	#endif
+	
+	// SipHash-2-4 bitsliced batch
+	{"bitsliced", sipHash24BitslicedBatch, nullptr}
+};
+
+
+// Function prototypes
+
+// Is SipHash-2-4 batch kernel supported
+static inline bool isSipHash24BatchKernelSupported(const SipHash24BatchKernel &kernel);
+
+// Benchmark SipHash-2-4 batch kernel
+static inline double benchmarkSipHash24BatchKernel(const SipHash24BatchKernel &kernel);
+
+
+// Main function
+int main() {
+
+	// Go through all SipHash-2-4 batch kernels
+	for(size_t i = 0; i < NUMBER_OF_SIPHASH24_BATCH_KERNELS; ++i) {
+	
+		// Check if SipHash-2-4 batch kernel isn't supported
+		if(!isSipHash24BatchKernelSupported(sipHash24BatchKernels[i])) {
+		
+			// Display message
+			cout << "Skipped the " << sipHash24BatchKernels[i].name << " SipHash-2-4 kernel since the CPU doesn't support it" << endl;
+			
+			// Continue
+			continue;
+		}
+		
+		// Display message
+		cout << "The " << sipHash24BatchKernels[i].name << " SipHash-2-4 kernel took " << benchmarkSipHash24BatchKernel(sipHash24BatchKernels[i]) << " ns per hash" << (sipHash24BatchKernels[i].function == sipHash24BatchFunction ? " and is selected on this CPU" : "") << endl;
+	}
+	
+	// Return success
+	return EXIT_SUCCESS;
+}
+
+// Is SipHash-2-4 batch kernel supported
+bool isSipHash24BatchKernelSupported(const SipHash24BatchKernel &kernel) {
+
+	// Check if SipHash-2-4 batch kernel doesn't need a CPU feature
+	if(!kernel.cpuFeature) {
+	
+		// Return true
+		return true;
+	}
+	
+	// Check if using x86
+	#if defined(__x86_64__) || defined(__i386__)
+	
+		// Initialize CPU features
+		__builtin_cpu_init();
+		
+		// Check if CPU supports AVX-512
+		if(!strcmp(kernel.cpuFeature, "avx512f")) {
+		
+			// Return if CPU supports AVX-512
+			return __builtin_cpu_supports("avx512f");
+		}
+		
+		// Check if CPU supports AVX2
+		if(!strcmp(kernel.cpuFeature, "avx2")) {
+		
+			// Return if CPU supports AVX2
+			return __builtin_cpu_supports("avx2");
+		}
+	#endif
+	
+	// Return false
+	return false;
+}
+
+// Benchmark SipHash-2-4 batch kernel
+double benchmarkSipHash24BatchKernel(const SipHash24BatchKernel &kernel) {
+
+	// Go through all nonces
+	static uint32_t nonces[NUMBER_OF_NONCES];
+	for(size_t i = 0; i < NUMBER_OF_NONCES; ++i) {
+	
+		// Set nonce to an edge's node's nonce
+		nonces[i] = i * 2;
+	}
+	
+	// Go through all runs
+	const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys = {0x0706050403020100, 0x0F0E0D0C0B0A0908, 0x1716151413121110, 0x1F1E1D1C1B1A1918};
+	static uint32_t results[NUMBER_OF_NONCES];
+	volatile uint32_t checksum = 0;
+	const chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+	for(int i = 0; i < NUMBER_OF_RUNS; ++i) {
+	
+		// Perform hashes on the nonces using the SipHash-2-4 batch kernel
+		kernel.function(sipHashKeys, nonces, results, NUMBER_OF_NONCES);
+		
+		// Include a result in the checksum so that the hashes aren't optimized away
+		checksum = checksum ^ results[i % NUMBER_OF_NONCES];
+	}
+	
+	// Return duration per hash
+	return chrono::duration<double, nano>(chrono::steady_clock::now() - startTime).count() / (static_cast<double>(NUMBER_OF_NONCES) * NUMBER_OF_RUNS);
+}
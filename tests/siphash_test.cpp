@@ -0,0 +1,226 @@
+// Constants
+
+// Number of iterations
+#define NUMBER_OF_ITERATIONS 1000
+
+// Max number of nonces
+#define MAX_NUMBER_OF_NONCES 1000
+
+// Number of SipHash-2-4 batch kernels
+#define NUMBER_OF_SIPHASH24_BATCH_KERNELS (sizeof(sipHash24BatchKernels) / sizeof(sipHash24BatchKernels[0]))
+
+
+// Header files
+
+// Rename the miner's main function so that the test can provide its own
+#define main minerMain
+#include "../main.cpp"
+#undef main
+
+
+// Structures
+
+// SipHash-2-4 batch kernel structure
+struct SipHash24BatchKernel {
+
+	// Name
+	const char *name;
+	
+	// Function
+	void (*function)(const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint32_t *nonces, uint32_t *results, const size_t numberOfNonces);
+	
+	// Number of lanes
+	size_t numberOfLanes;
+	
+	// CPU feature
+	const char *cpuFeature;
+};
+
+
+// Global variables
+
+// SipHash-2-4 batch kernels
+static const SipHash24BatchKernel sipHash24BatchKernels[] = {
+
+	// SipHash-2-4 batch
+	{"selected", sipHash24Batch, 1, nullptr},
+	
+	// SipHash-2-4 scalar batch
+	{"scalar", sipHash24ScalarBatch, 1, nullptr},
+	
+	// Check if using x86
+	#if defined(__x86_64__) || defined(__i386__)
+	
+		// SipHash-2-4 AVX2 batch
+		{"AVX2", sipHash24Avx2Batch, SIPHASH24_AVX2_NUMBER_OF_LANES, "avx2"},
+		
+		// SipHash-2-4 AVX-512 batch
+		{"AVX-512", sipHash24Avx512Batch, SIPHASH24_AVX512_NUMBER_OF_LANES, "avx512f"},
+	#endif
+	
+	// SipHash-2-4 bitsliced batch
+	{"bitsliced", sipHash24BitslicedBatch, SIPHASH24_BITSLICED_NUMBER_OF_LANES, nullptr}
+};
+
+// Random number generator
+static mt19937_64 randomNumberGenerator;
+
+
+// Function prototypes
+
+// Is SipHash-2-4 batch kernel supported
+static inline bool isSipHash24BatchKernelSupported(const SipHash24BatchKernel &kernel);
+
+// Test SipHash-2-4 batch kernel
+static inline bool testSipHash24BatchKernel(const SipHash24BatchKernel &kernel);
+
+// Test SipHash-2-4 batch kernel with number of nonces
+static inline bool testSipHash24BatchKernelWithNumberOfNonces(const SipHash24BatchKernel &kernel, const size_t numberOfNonces);
+
+
+// Main function
+int main() {
+
+	// Go through all SipHash-2-4 batch kernels
+	bool passed = true;
+	for(size_t i = 0; i < NUMBER_OF_SIPHASH24_BATCH_KERNELS; ++i) {
+	
+		// Check if SipHash-2-4 batch kernel isn't supported
+		if(!isSipHash24BatchKernelSupported(sipHash24BatchKernels[i])) {
+		
+			// Display message
+			cout << "Skipped the " << sipHash24BatchKernels[i].name << " SipHash-2-4 kernel since the CPU doesn't support it" << endl;
+			
+			// Continue
+			continue;
+		}
+		
+		// Check if testing SipHash-2-4 batch kernel failed
+		if(!testSipHash24BatchKernel(sipHash24BatchKernels[i])) {
+		
+			// Set passed to false
+			passed = false;
+		}
+		
+		// Otherwise
+		else {
+		
+			// Display message
+			cout << "The " << sipHash24BatchKernels[i].name << " SipHash-2-4 kernel matched SipHash-2-4 for " << NUMBER_OF_ITERATIONS << " random batches" << endl;
+		}
+	}
+	
+	// Return if test passed
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Is SipHash-2-4 batch kernel supported
+bool isSipHash24BatchKernelSupported(const SipHash24BatchKernel &kernel) {
+
+	// Check if SipHash-2-4 batch kernel doesn't need a CPU feature
+	if(!kernel.cpuFeature) {
+	
+		// Return true
+		return true;
+	}
+	
+	// Check if using x86
+	#if defined(__x86_64__) || defined(__i386__)
+	
+		// Initialize CPU features
+		__builtin_cpu_init();
+		
+		// Check if CPU supports AVX-512
+		if(!strcmp(kernel.cpuFeature, "avx512f")) {
+		
+			// Return if CPU supports AVX-512
+			return __builtin_cpu_supports("avx512f");
+		}
+		
+		// Check if CPU supports AVX2
+		if(!strcmp(kernel.cpuFeature, "avx2")) {
+		
+			// Return if CPU supports AVX2
+			return __builtin_cpu_supports("avx2");
+		}
+	#endif
+	
+	// Return false
+	return false;
+}
+
+// Test SipHash-2-4 batch kernel
+bool testSipHash24BatchKernel(const SipHash24BatchKernel &kernel) {
+
+	// Go through all numbers of nonces around the number of lanes
+	for(size_t numberOfNonces = 0; numberOfNonces <= kernel.numberOfLanes * 3 + 1; ++numberOfNonces) {
+	
+		// Check if testing SipHash-2-4 batch kernel with the number of nonces failed
+		if(!testSipHash24BatchKernelWithNumberOfNonces(kernel, numberOfNonces)) {
+		
+			// Return false
+			return false;
+		}
+	}
+	
+	// Go through all iterations
+	for(int i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Check if testing SipHash-2-4 batch kernel with a random number of nonces failed
+		if(!testSipHash24BatchKernelWithNumberOfNonces(kernel, randomNumberGenerator() % (MAX_NUMBER_OF_NONCES + 1))) {
+		
+			// Return false
+			return false;
+		}
+	}
+	
+	// Return true
+	return true;
+}
+
+// Test SipHash-2-4 batch kernel with number of nonces
+bool testSipHash24BatchKernelWithNumberOfNonces(const SipHash24BatchKernel &kernel, const size_t numberOfNonces) {
+
+	// Get random SipHash keys
+	const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys = {randomNumberGenerator(), randomNumberGenerator(), randomNumberGenerator(), randomNumberGenerator()};
+	
+	// Go through all nonces
+	uint32_t nonces[MAX_NUMBER_OF_NONCES];
+	uint32_t results[MAX_NUMBER_OF_NONCES + 1];
+	for(size_t i = 0; i < numberOfNonces; ++i) {
+	
+		// Set nonce to a random value
+		nonces[i] = randomNumberGenerator();
+	}
+	
+	// Perform hashes on the nonces using the SipHash-2-4 batch kernel
+	results[numberOfNonces] = UINT32_MAX;
+	kernel.function(sipHashKeys, nonces, results, numberOfNonces);
+	
+	// Check if the SipHash-2-4 batch kernel wrote past its results
+	if(results[numberOfNonces] != UINT32_MAX) {
+	
+		// Display message
+		cout << "The " << kernel.name << " SipHash-2-4 kernel wrote past its results for " << numberOfNonces << " nonces" << endl;
+		
+		// Return false
+		return false;
+	}
+	
+	// Go through all nonces
+	for(size_t i = 0; i < numberOfNonces; ++i) {
+	
+		// Check if the SipHash-2-4 batch kernel's result isn't the nonce's hash
+		if(results[i] != sipHash24(sipHashKeys, nonces[i])) {
+		
+			// Display message
+			cout << "The " << kernel.name << " SipHash-2-4 kernel's result for nonce " << i << " of " << numberOfNonces << " is " << results[i] << " instead of " << sipHash24(sipHashKeys, nonces[i]) << endl;
+			
+			// Return false
+			return false;
+		}
+	}
+	
+	// Return true
+	return true;
+}
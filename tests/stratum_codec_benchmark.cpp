@@ -0,0 +1,91 @@
+// Constants
+
+// Number of iterations
+#define NUMBER_OF_ITERATIONS 1000000
+
+// Job message
+#define JOB_MESSAGE "{\"id\":\"Stratum\",\"jsonrpc\":\"2.0\",\"method\":\"job\",\"params\":{\"difficulty\":1,\"height\":2431234,\"job_id\":7,\"pre_pow\":\"a54dca182530bb1d6d132cded6237b2ed91e3f721fcb1971174494d6493c9d5c3460be31201e69fedaa0eee8b9997f5c7c2999fdafe593253cd654af4dfad71427a0aeb3fee9232f8af2211f9ee491c5b10becb5563bfc1e6f93427ecbc8fe2955e5cd8e46dc8ed4b7c2764d2a5a4d767706f85d8690024ad6bda3401be9c8cbccc935f6cd1f61226ae15338ae1a34004d33ba0d246ac04c81b1baf23e3bf9eef5f79f2b4934af87f5520b69b94b0d982e85bb55b672a872637acd7466fcb60e0e8ff18463b0e4b2ba29703474f064ac68f700f5b02b3dc666f45bdeaa2ccaedcd2b5157410e4dee4af2b34f430a\"}}"
+
+// Submit response message
+#define SUBMIT_RESPONSE_MESSAGE "{\"id\":\"2\",\"jsonrpc\":\"2.0\",\"method\":\"submit\",\"result\":null,\"error\":{\"code\":-32503,\"message\":\"Solution submitted too late\"}}"
+
+
+// Header files
+
+// Rename the miner's main function so that the benchmark can provide its own
+#define main minerMain
+#include "../main.cpp"
+#undef main
+
+
+// Function prototypes
+
+// Benchmark
+template<typename Operation> static inline void benchmark(const char *name, const Operation &operation);
+
+
+// Main function
+int main() {
+
+	// Check if the job message can't be parsed
+	StratumMessage message;
+	if(!parseStratumMessage(JOB_MESSAGE, sizeof(JOB_MESSAGE) - sizeof('\0'), message) || !message.hasHeader) {
+	
+		// Display message
+		cout << "Parsing job message failed" << endl;
+		
+		// Return failure
+		return EXIT_FAILURE;
+	}
+	
+	// Benchmark parsing job message
+	benchmark("Parsing job message", [&message](const uint64_t iteration) -> uint64_t {
+	
+		// Return parsed job's height
+		parseStratumMessage(JOB_MESSAGE, sizeof(JOB_MESSAGE) - sizeof('\0'), message);
+		return message.height + iteration;
+	});
+	
+	// Benchmark parsing submit response message
+	benchmark("Parsing submit response message", [&message](const uint64_t iteration) -> uint64_t {
+	
+		// Return parsed response's error code
+		parseStratumMessage(SUBMIT_RESPONSE_MESSAGE, sizeof(SUBMIT_RESPONSE_MESSAGE) - sizeof('\0'), message);
+		return message.errorCode + iteration;
+	});
+	
+	// Get a solution with large edge indices
+	uint32_t solution[SOLUTION_SIZE];
+	for(int i = 0; i < SOLUTION_SIZE; ++i) {
+	
+		// Set edge index
+		solution[i] = NUMBER_OF_EDGES - (SOLUTION_SIZE - i) * 7919;
+	}
+	
+	// Benchmark writing submit request
+	benchmark("Writing submit request", [&solution](const uint64_t iteration) -> uint64_t {
+	
+		// Return submit request's size
+		char request[SUBMIT_REQUEST_SIZE];
+		return writeStratumSubmitRequest(request, iteration, 2431234, 7, iteration * 0x9E3779B97F4A7C15, solution) + request[iteration % sizeof("{\"id\":\"")];
+	});
+	
+	// Return success
+	return EXIT_SUCCESS;
+}
+
+// Benchmark
+template<typename Operation> void benchmark(const char *name, const Operation &operation) {
+
+	// Go through all iterations
+	const chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+	volatile uint64_t checksum = 0;
+	for(uint64_t i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Include operation's result in the checksum so that it isn't optimized away
+		checksum = checksum + operation(i);
+	}
+	
+	// Display message
+	cout << name << " took " << chrono::duration<double, nano>(chrono::steady_clock::now() - startTime).count() / NUMBER_OF_ITERATIONS << " ns" << endl;
+}
@@ -0,0 +1,308 @@
+// Constants
+
+// Number of iterations
+#define NUMBER_OF_ITERATIONS 100000
+
+// Max random message size
+#define MAX_RANDOM_MESSAGE_SIZE 256
+
+// Max number of mutations
+#define MAX_NUMBER_OF_MUTATIONS 8
+
+// Max line size
+#define MAX_LINE_SIZE (STRATUM_SERVER_RESPONSE_BUFFER_SIZE / 4)
+
+// Random message characters
+#define RANDOM_MESSAGE_CHARACTERS "{}[]\":,-\\ 0123456789abcdefnultrsij_\n"
+
+
+// Header files
+#include <string>
+
+// Rename the miner's main function so that the test can provide its own
+#define main minerMain
+#include "../main.cpp"
+#undef main
+
+
+// Global variables
+
+// Random number generator
+static mt19937_64 randomNumberGenerator;
+
+
+// Function prototypes
+
+// Parse message
+static inline bool parseMessage(const string &line, StratumMessage &message);
+
+// Create random message
+static inline string createRandomMessage();
+
+// Create job message
+static inline string createJobMessage(const uint64_t height, const uint64_t jobId, const uint8_t header[HEADER_SIZE]);
+
+// Create submit response message
+static inline string createSubmitResponseMessage(const uint32_t requestId, const int64_t errorCode);
+
+// Mutate message
+static inline void mutateMessage(string &message);
+
+// Fuzz parse stratum message
+static inline bool fuzzParseStratumMessage();
+
+// Fuzz stratum line buffer
+static inline bool fuzzStratumLineBuffer();
+
+
+// Main function
+int main() {
+
+	// Check if fuzzing parsing stratum messages or fuzzing the stratum line buffer failed
+	if(!fuzzParseStratumMessage() || !fuzzStratumLineBuffer()) {
+	
+		// Return failure
+		return EXIT_FAILURE;
+	}
+	
+	// Display message
+	cout << "Parsed " << NUMBER_OF_ITERATIONS << " random, valid, and mutated stratum messages and split " << NUMBER_OF_ITERATIONS << " lines with the stratum line buffer" << endl;
+	
+	// Return success
+	return EXIT_SUCCESS;
+}
+
+// Parse message
+bool parseMessage(const string &line, StratumMessage &message) {
+
+	// Copy line to a buffer that's exactly its size so that reading past its end can be detected
+	const unique_ptr<char[]> buffer(new char[max(line.size(), static_cast<size_t>(1))]);
+	memcpy(buffer.get(), line.data(), line.size());
+	
+	// Return if parsing the line was successful
+	return parseStratumMessage(buffer.get(), line.size(), message);
+}
+
+// Create random message
+string createRandomMessage() {
+
+	// Go through all of the message's characters
+	string message(randomNumberGenerator() % (MAX_RANDOM_MESSAGE_SIZE + 1), '\0');
+	for(char &character : message) {
+	
+		// Set character to a random JSON character or a random byte
+		character = (randomNumberGenerator() % 4) ? RANDOM_MESSAGE_CHARACTERS[randomNumberGenerator() % (sizeof(RANDOM_MESSAGE_CHARACTERS) - sizeof('\0'))] : static_cast<char>(randomNumberGenerator());
+	}
+	
+	// Return message
+	return message;
+}
+
+// Create job message
+string createJobMessage(const uint64_t height, const uint64_t jobId, const uint8_t header[HEADER_SIZE]) {
+
+	// Go through all of the header's bytes
+	string headerHex;
+	for(size_t i = 0; i < HEADER_SIZE; ++i) {
+	
+		// Append byte's hex to the header hex
+		headerHex += "0123456789abcdef"[header[i] >> 4];
+		headerHex += "0123456789abcdef"[header[i] & 0xF];
+	}
+	
+	// Return job message
+	return "{\"id\":\"Stratum\",\"jsonrpc\":\"2.0\",\"method\":\"job\",\"params\":{\"difficulty\":1,\"height\":" + to_string(height) + ",\"job_id\":" + to_string(jobId) + ",\"pre_pow\":\"" + headerHex + "\"}}";
+}
+
+// Create submit response message
+string createSubmitResponseMessage(const uint32_t requestId, const int64_t errorCode) {
+
+	// Return submit response message with a result if the error code is zero or an error otherwise
+	return "{\"id\":\"" + to_string(requestId) + "\",\"jsonrpc\":\"2.0\",\"method\":\"submit\"," + (errorCode ? "\"result\":null,\"error\":{\"code\":" + to_string(errorCode) + ",\"message\":\"Failed\"}}" : string("\"result\":\"ok\",\"error\":null}"));
+}
+
+// Mutate message
+void mutateMessage(string &message) {
+
+	// Go through all mutations
+	for(uint64_t i = randomNumberGenerator() % MAX_NUMBER_OF_MUTATIONS + 1; i; --i) {
+	
+		// Check mutation
+		const size_t position = message.empty() ? 0 : randomNumberGenerator() % message.size();
+		switch(randomNumberGenerator() % 4) {
+		
+			// Replace character
+			case 0:
+			
+				// Check if message isn't empty
+				if(!message.empty()) {
+				
+					// Replace character with a random JSON character
+					message[position] = RANDOM_MESSAGE_CHARACTERS[randomNumberGenerator() % (sizeof(RANDOM_MESSAGE_CHARACTERS) - sizeof('\0'))];
+				}
+				
+				// Break
+				break;
+			
+			// Insert character
+			case 1:
+			
+				// Insert a random JSON character
+				message.insert(message.begin() + position, RANDOM_MESSAGE_CHARACTERS[randomNumberGenerator() % (sizeof(RANDOM_MESSAGE_CHARACTERS) - sizeof('\0'))]);
+				
+				// Break
+				break;
+			
+			// Remove character
+			case 2:
+			
+				// Check if message isn't empty
+				if(!message.empty()) {
+				
+					// Remove character
+					message.erase(position, 1);
+				}
+				
+				// Break
+				break;
+			
+			// Truncate
+			default:
+			
+				// Remove everything after the position
+				message.resize(position);
+				
+				// Break
+				break;
+		}
+	}
+}
+
+// Fuzz parse stratum message
+bool fuzzParseStratumMessage() {
+
+	// Go through all iterations
+	for(int i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Parse random message
+		StratumMessage message;
+		parseMessage(createRandomMessage(), message);
+		
+		// Get random job
+		const uint64_t height = randomNumberGenerator() | 1;
+		const uint64_t jobId = randomNumberGenerator() >> (randomNumberGenerator() % 64);
+		uint8_t header[HEADER_SIZE];
+		for(uint8_t &byte : header) {
+		
+			// Set byte to a random value
+			byte = randomNumberGenerator();
+		}
+		
+		// Check if parsing the job message failed or its job is different
+		string jobMessage = createJobMessage(height, jobId, header);
+		if(!parseMessage(jobMessage, message) || message.method != StratumMethod::JOB || !message.hasHeight || message.height != height || !message.hasJobId || message.jobId != jobId || !message.hasHeader || memcmp(message.header, header, sizeof(header))) {
+		
+			// Display message
+			cout << "Parsing job message failed: " << jobMessage << endl;
+			
+			// Return false
+			return false;
+		}
+		
+		// Check if parsing the submit response message failed or its result is different
+		const uint32_t requestId = randomNumberGenerator();
+		const int64_t errorCode = (randomNumberGenerator() % 2) ? -static_cast<int64_t>(randomNumberGenerator() % 100000) : 0;
+		string submitResponseMessage = createSubmitResponseMessage(requestId, errorCode);
+		if(!parseMessage(submitResponseMessage, message) || message.method != StratumMethod::SUBMIT || !message.hasId || message.id != requestId || message.errorIsNull != !errorCode || (errorCode && (!message.hasErrorCode || message.errorCode != errorCode))) {
+		
+			// Display message
+			cout << "Parsing submit response message failed: " << submitResponseMessage << endl;
+			
+			// Return false
+			return false;
+		}
+		
+		// Parse mutated job message and mutated submit response message
+		mutateMessage(jobMessage);
+		parseMessage(jobMessage, message);
+		mutateMessage(submitResponseMessage);
+		parseMessage(submitResponseMessage, message);
+	}
+	
+	// Return true
+	return true;
+}
+
+// Fuzz stratum line buffer
+bool fuzzStratumLineBuffer() {
+
+	// Go through all iterations
+	string input;
+	for(int i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Append a line with random characters that aren't newlines to the input
+		for(uint64_t j = randomNumberGenerator() % MAX_LINE_SIZE; j; --j) {
+		
+			// Append random character that isn't a newline to the input
+			const char character = randomNumberGenerator();
+			input += (character == '\n') ? ' ' : character;
+		}
+		input += '\n';
+	}
+	
+	// Loop until all input was given to the line buffer
+	static StratumLineBuffer lineBuffer;
+	string output;
+	for(size_t inputIndex = 0; inputIndex != input.size();) {
+	
+		// Check if the line buffer doesn't have free space
+		size_t freeSpace;
+		char *destination = lineBuffer.getFreeSpace(freeSpace);
+		if(!freeSpace) {
+		
+			// Display message
+			cout << "Stratum line buffer is full" << endl;
+			
+			// Return false
+			return false;
+		}
+		
+		// Give a random amount of the input to the line buffer
+		const size_t size = min(randomNumberGenerator() % freeSpace + 1, input.size() - inputIndex);
+		memcpy(destination, &input[inputIndex], size);
+		lineBuffer.commit(size);
+		inputIndex += size;
+		
+		// Check if complete lines exist
+		const char *lines;
+		size_t linesSize;
+		if(lineBuffer.getLines(lines, linesSize)) {
+		
+			// Check if lines don't end with a newline
+			if(lines[linesSize - sizeof('\n')] != '\n') {
+			
+				// Display message
+				cout << "Stratum line buffer returned an incomplete line" << endl;
+				
+				// Return false
+				return false;
+			}
+			
+			// Append lines to the output
+			output.append(lines, linesSize);
+		}
+	}
+	
+	// Check if the output isn't the input
+	if(output != input) {
+	
+		// Display message
+		cout << "Stratum line buffer changed lines" << endl;
+		
+		// Return false
+		return false;
+	}
+	
+	// Return true
+	return true;
+}
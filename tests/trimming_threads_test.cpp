@@ -0,0 +1,279 @@
+// Constants
+
+// Number of nonces
+#define NUMBER_OF_NONCES 8
+
+// Number of trimming configurations
+#define NUMBER_OF_TRIMMING_CONFIGURATIONS (sizeof(trimmingConfigurations) / sizeof(trimmingConfigurations[0]))
+
+// Small nodes bitmap part size
+#define SMALL_NODES_BITMAP_PART_SIZE (BYTES_PER_BITMAP / 8)
+
+// Remaining edges hash offset basis
+#define REMAINING_EDGES_HASH_OFFSET_BASIS 0x14650FB0739D0383
+
+// Remaining edges hash prime
+#define REMAINING_EDGES_HASH_PRIME 0x100000001B3
+
+
+// Header files
+#include <vector>
+
+// Rename the miner's main function so that the test can provide its own
+#define main minerMain
+#include "../main.cpp"
+#undef main
+
+
+// Structures
+
+// Trimming configuration structure
+struct TrimmingConfiguration {
+
+	// Name
+	const char *name;
+	
+	// Trimmer type
+	TrimmerType trimmerType;
+	
+	// Edges bitmap in memory
+	bool edgesBitmapInMemory;
+	
+	// Max nodes bitmap part size
+	size_t maxNodesBitmapPartSize;
+};
+
+// Baseline remaining edges structure
+struct BaselineRemainingEdges {
+
+	// Number of edges
+	size_t numberOfEdges;
+	
+	// Hash
+	uint64_t hash;
+};
+
+
+// Global variables
+
+// Trimming configurations
+static const TrimmingConfiguration trimmingConfigurations[] = {
+
+	// Lean trimmer with edges bitmap in memory
+	{"lean trimmer with edges bitmap in memory", TrimmerType::LEAN, true, 0},
+	
+	// Lean trimmer with edges bitmap in memory and small nodes bitmap parts
+	{"lean trimmer with edges bitmap in memory and small nodes bitmap parts", TrimmerType::LEAN, true, SMALL_NODES_BITMAP_PART_SIZE},
+	
+	// Lean trimmer with edges bitmap in storage
+	{"lean trimmer with edges bitmap in storage", TrimmerType::LEAN, false, 0},
+	
+	// Lean trimmer with edges bitmap in storage and small nodes bitmap parts
+	{"lean trimmer with edges bitmap in storage and small nodes bitmap parts", TrimmerType::LEAN, false, SMALL_NODES_BITMAP_PART_SIZE},
+	
+	// Mean trimmer with edges bitmap in memory
+	{"mean trimmer with edges bitmap in memory", TrimmerType::MEAN, true, 0}
+};
+
+// Baseline remaining edges from the single-threaded lean trimmer
+static const BaselineRemainingEdges baselineRemainingEdges[NUMBER_OF_NONCES] = {
+	{30113, 0x5F0526848F5B95E3},
+	{30831, 0xC27CF2E89C798148},
+	{31100, 0xB39C7C268697E4E5},
+	{30902, 0xE4E1E972F9213DC1},
+	{31119, 0x3D26891C5F15F273},
+	{31229, 0x86A3E7748F601769},
+	{30830, 0x8A377CA351E0BE15},
+	{30415, 0xB085EC399018181E}
+};
+
+
+// Function prototypes
+
+// Get all remaining edges
+static inline bool getAllRemainingEdges(const unsigned int numberOfThreads, vector<uint32_t> remainingEdges[NUMBER_OF_NONCES][NUMBER_OF_TRIMMING_CONFIGURATIONS]);
+
+// Get remaining edges
+static inline bool getRemainingEdges(const uint64_t nonce, const TrimmingConfiguration &configuration, EdgesBitmapStorage &edgesBitmapStorage, vector<uint32_t> &remainingEdges);
+
+// Get remaining edges hash
+static inline uint64_t getRemainingEdgesHash(const vector<uint32_t> &remainingEdges);
+
+
+// Main function
+int main() {
+
+	// Check if configuring console failed
+	console = consoleDemoInit();
+	if(!console) {
+	
+		// Return failure
+		return EXIT_FAILURE;
+	}
+	
+	// Check if getting all remaining edges using one thread and using multiple threads failed
+	const unsigned int numberOfThreads = max(thread::hardware_concurrency(), 2U);
+	static vector<uint32_t> singleThreadRemainingEdges[NUMBER_OF_NONCES][NUMBER_OF_TRIMMING_CONFIGURATIONS];
+	static vector<uint32_t> multipleThreadsRemainingEdges[NUMBER_OF_NONCES][NUMBER_OF_TRIMMING_CONFIGURATIONS];
+	if(!getAllRemainingEdges(1, singleThreadRemainingEdges) || !getAllRemainingEdges(numberOfThreads, multipleThreadsRemainingEdges)) {
+	
+		// Display message
+		cout << endl << "Trimming edges failed" << endl;
+		
+		// Return failure
+		return EXIT_FAILURE;
+	}
+	
+	// Go through all nonces
+	bool passed = true;
+	for(uint64_t nonce = 0; nonce < NUMBER_OF_NONCES; ++nonce) {
+	
+		// Go through all trimming configurations
+		for(size_t i = 0; i < NUMBER_OF_TRIMMING_CONFIGURATIONS; ++i) {
+		
+			// Check if the remaining edges are different from the baseline's
+			if(singleThreadRemainingEdges[nonce][i].size() != baselineRemainingEdges[nonce].numberOfEdges || getRemainingEdgesHash(singleThreadRemainingEdges[nonce][i]) != baselineRemainingEdges[nonce].hash) {
+			
+				// Display message
+				cout << endl << "Nonce " << nonce << " using " << trimmingConfigurations[i].name << " kept " << singleThreadRemainingEdges[nonce][i].size() << " edges with 1 thread instead of the baseline's " << baselineRemainingEdges[nonce].numberOfEdges << " edges" << endl;
+				
+				// Set passed to false
+				passed = false;
+			}
+			
+			// Check if the remaining edges are different
+			if(singleThreadRemainingEdges[nonce][i] != multipleThreadsRemainingEdges[nonce][i]) {
+			
+				// Display message
+				cout << endl << "Nonce " << nonce << " using " << trimmingConfigurations[i].name << " kept " << singleThreadRemainingEdges[nonce][i].size() << " edges with 1 thread and " << multipleThreadsRemainingEdges[nonce][i].size() << " different edges with " << numberOfThreads << " threads" << endl;
+				
+				// Set passed to false
+				passed = false;
+			}
+		}
+	}
+	
+	// Check if test failed
+	if(!passed) {
+	
+		// Return failure
+		return EXIT_FAILURE;
+	}
+	
+	// Display message
+	cout << endl << "Trimming with 1 and " << numberOfThreads << " threads kept the baseline's edges for " << NUMBER_OF_NONCES << " nonces" << endl;
+	
+	// Return success
+	return EXIT_SUCCESS;
+}
+
+// Get all remaining edges
+bool getAllRemainingEdges(const unsigned int numberOfThreads, vector<uint32_t> remainingEdges[NUMBER_OF_NONCES][NUMBER_OF_TRIMMING_CONFIGURATIONS]) {
+
+	// Create trimming threads
+	trimmingThreads = make_unique<ThreadPool>(numberOfThreads);
+	
+	// Check if creating edges bitmap storage failed
+	const unique_ptr<EdgesBitmapStorage> edgesBitmapStorage = createEdgesBitmapStorage(EdgesBitmapStorageType::STREAM);
+	if(!edgesBitmapStorage) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Go through all nonces
+	bool result = true;
+	for(uint64_t nonce = 0; result && nonce < NUMBER_OF_NONCES; ++nonce) {
+	
+		// Go through all trimming configurations
+		for(size_t i = 0; i < NUMBER_OF_TRIMMING_CONFIGURATIONS; ++i) {
+		
+			// Check if getting the remaining edges failed
+			if(!getRemainingEdges(nonce, trimmingConfigurations[i], *edgesBitmapStorage, remainingEdges[nonce][i])) {
+			
+				// Set result to false
+				result = false;
+				
+				// Break
+				break;
+			}
+		}
+	}
+	
+	// Remove edges bitmap file
+	remove(EDGES_BITMAP_FILE);
+	
+	// Return result
+	return result;
+}
+
+// Get remaining edges
+bool getRemainingEdges(const uint64_t nonce, const TrimmingConfiguration &configuration, EdgesBitmapStorage &edgesBitmapStorage, vector<uint32_t> &remainingEdges) {
+
+	// Set trimmer type and max nodes bitmap part size
+	trimmerType = configuration.trimmerType;
+	maxNodesBitmapPartSize = configuration.maxNodesBitmapPartSize;
+	
+	// Check if edges bitmap is in memory and creating it failed
+	const unique_ptr<uint32_t[]> edgesBitmap(configuration.edgesBitmapInMemory ? new(nothrow) uint32_t[BYTES_PER_BITMAP / sizeof(uint32_t)] : nullptr);
+	if(configuration.edgesBitmapInMemory && !edgesBitmap) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if edges bitmap isn't in memory and creating edges bitmap file failed
+	if(!edgesBitmap && !edgesBitmapStorage.open(EDGES_BITMAP_FILE, BYTES_PER_BITMAP)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Get SipHash keys from an empty job header and the nonce
+	const uint8_t jobHeader[HEADER_SIZE] = {};
+	uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys;
+	blake2b(jobHeader, nonce, sipHashKeys);
+	
+	// Check if trimming edges failed
+	CompactEdgeList compactEdgeList;
+	size_t numberOfRemainingEdges;
+	int numberOfTrimmingRounds;
+	if(trimEdges(sipHashKeys, edgesBitmapStorage, edgesBitmap.get(), nullptr, compactEdgeList, numberOfRemainingEdges, numberOfTrimmingRounds) != TrimmingResult::SUCCEEDED || compactEdgeList.getNumberOfEdges() != numberOfRemainingEdges) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Go through all remaining edges
+	for(size_t i = 0; i < compactEdgeList.getNumberOfEdges(); ++i) {
+	
+		// Add edge's index to the remaining edges
+		remainingEdges.push_back(compactEdgeList.getEdges()[i].edgeIndex);
+	}
+	
+	// Return true
+	return true;
+}
+
+// Get remaining edges hash
+uint64_t getRemainingEdgesHash(const vector<uint32_t> &remainingEdges) {
+
+	// Go through all remaining edges
+	vector<uint32_t> edgesBitmap(BYTES_PER_BITMAP / sizeof(uint32_t), 0);
+	for(const uint32_t edgeIndex : remainingEdges) {
+	
+		// Enable edge in edges bitmap
+		edgesBitmap[edgeIndex / (sizeof(edgesBitmap[0]) * BITS_IN_A_BYTE)] |= 1 << (edgeIndex % (sizeof(edgesBitmap[0]) * BITS_IN_A_BYTE));
+	}
+	
+	// Go through all groups of edges in the edges bitmap
+	uint64_t hash = REMAINING_EDGES_HASH_OFFSET_BASIS;
+	for(const uint32_t edgeGroup : edgesBitmap) {
+	
+		// Include group of edges in the hash
+		hash = (hash ^ edgeGroup) * REMAINING_EDGES_HASH_PRIME;
+	}
+	
+	// Return hash
+	return hash;
+}
@@ -0,0 +1,201 @@
+// Header guard
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+
+// Header files
+using namespace std;
+
+
+// Classes
+
+// Thread pool class
+class ThreadPool final {
+
+	// Public
+	public:
+	
+		// Constructor
+		inline explicit ThreadPool(const unsigned int numberOfThreads);
+		
+		// Destructor
+		inline ~ThreadPool();
+		
+		// Get number of threads
+		inline unsigned int getNumberOfThreads() const;
+		
+		// Run
+		inline void run(const function<void(const unsigned int threadIndex)> &task);
+	
+	// Private
+	private:
+	
+		// Work
+		inline void work(const unsigned int threadIndex);
+		
+		// Number of threads
+		const unsigned int numberOfThreads;
+		
+		// Workers
+		unique_ptr<thread[]> workers;
+		
+		// Lock
+		mutex lock;
+		
+		// Task available condition
+		condition_variable taskAvailableCondition;
+		
+		// Task finished condition
+		condition_variable taskFinishedCondition;
+		
+		// Task
+		const function<void(const unsigned int threadIndex)> *task;
+		
+		// Task generation
+		uint64_t taskGeneration;
+		
+		// Number of running workers
+		unsigned int numberOfRunningWorkers;
+		
+		// Stop
+		bool stop;
+};
+
+
+// Supporting function implementation
+
+// Constructor
+ThreadPool::ThreadPool(const unsigned int numberOfThreads) :
+
+	// Set number of threads
+	numberOfThreads(max(numberOfThreads, 1U)),
+	
+	// Create workers
+	workers(new thread[this->numberOfThreads - 1]),
+	
+	// Set task to nothing
+	task(nullptr),
+	
+	// Set task generation to zero
+	taskGeneration(0),
+	
+	// Set number of running workers to zero
+	numberOfRunningWorkers(0),
+	
+	// Set stop to false
+	stop(false)
+{
+
+	// Go through all workers
+	for(unsigned int i = 0; i < this->numberOfThreads - 1; ++i) {
+	
+		// Start worker
+		workers[i] = thread(&ThreadPool::work, this, i + 1);
+	}
+}
+
+// Destructor
+ThreadPool::~ThreadPool() {
+
+	// Set stop to true
+	{
+		const lock_guard<mutex> guard(lock);
+		stop = true;
+	}
+	
+	// Wake all workers
+	taskAvailableCondition.notify_all();
+	
+	// Go through all workers
+	for(unsigned int i = 0; i < numberOfThreads - 1; ++i) {
+	
+		// Wait for worker to finish
+		workers[i].join();
+	}
+}
+
+// Get number of threads
+unsigned int ThreadPool::getNumberOfThreads() const {
+
+	// Return number of threads
+	return numberOfThreads;
+}
+
+// Run
+void ThreadPool::run(const function<void(const unsigned int threadIndex)> &task) {
+
+	// Check if there's only one thread
+	if(numberOfThreads == 1) {
+	
+		// Run task on the current thread
+		task(0);
+		
+		// Return
+		return;
+	}
+	
+	// Give task to the workers
+	{
+		const lock_guard<mutex> guard(lock);
+		this->task = &task;
+		++taskGeneration;
+		numberOfRunningWorkers = numberOfThreads - 1;
+	}
+	taskAvailableCondition.notify_all();
+	
+	// Run task on the current thread
+	task(0);
+	
+	// Wait for the workers to finish the task
+	unique_lock<mutex> guard(lock);
+	taskFinishedCondition.wait(guard, [this]() {
+	
+		// Return if all workers finished
+		return !numberOfRunningWorkers;
+	});
+	
+	// Set task to nothing
+	this->task = nullptr;
+}
+
+// Work
+void ThreadPool::work(const unsigned int threadIndex) {
+
+	// Loop forever
+	for(uint64_t lastTaskGeneration = 0;;) {
+	
+		// Wait for a new task or to stop
+		unique_lock<mutex> guard(lock);
+		taskAvailableCondition.wait(guard, [this, lastTaskGeneration]() {
+		
+			// Return if stopping or a new task exists
+			return stop || taskGeneration != lastTaskGeneration;
+		});
+		
+		// Check if stopping
+		if(stop) {
+		
+			// Return
+			return;
+		}
+		
+		// Update last task generation
+		lastTaskGeneration = taskGeneration;
+		
+		// Run task
+		const function<void(const unsigned int threadIndex)> &currentTask = *task;
+		guard.unlock();
+		currentTask(threadIndex);
+		
+		// Check if all workers finished the task
+		guard.lock();
+		if(!--numberOfRunningWorkers) {
+		
+			// Signal that the task is finished
+			taskFinishedCondition.notify_one();
+		}
+	}
+}
+
+
+#endif
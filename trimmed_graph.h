@@ -0,0 +1,236 @@
+// Header guard
+#ifndef TRIMMED_GRAPH_H
+#define TRIMMED_GRAPH_H
+
+
+// Header files
+using namespace std;
+
+
+// Constants
+
+// Trimmed graph magic
+#define TRIMMED_GRAPH_MAGIC "MWCGRAPH"
+
+// Trimmed graph version
+#define TRIMMED_GRAPH_VERSION 1
+
+
+// Structures
+
+// Trimmed graph header structure
+struct TrimmedGraphHeader {
+
+	// Magic
+	char magic[sizeof(TRIMMED_GRAPH_MAGIC) - sizeof('\0')];
+	
+	// Version
+	uint32_t version;
+	
+	// Edge bits
+	uint32_t edgeBits;
+	
+	// SipHash keys
+	uint64_t sipHashKeys[SIPHASH_KEYS_SIZE];
+	
+	// Job nonce
+	uint64_t jobNonce;
+	
+	// Number of edges
+	uint64_t numberOfEdges;
+	
+	// Number of trimming rounds
+	uint32_t numberOfTrimmingRounds;
+	
+	// Has nodes
+	uint32_t hasNodes;
+	
+	// Job header
+	uint8_t jobHeader[HEADER_SIZE];
+};
+
+
+// Function prototypes
+
+// Dump trimmed graph
+static inline bool dumpTrimmedGraph(const char *path, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint8_t jobHeader[HEADER_SIZE], const uint64_t jobNonce, const int numberOfTrimmingRounds, const CompactEdgeList &compactEdgeList, const bool includeNodes);
+
+// Load trimmed graph
+static inline bool loadTrimmedGraph(const char *path, TrimmedGraphHeader &header, CompactEdgeList &compactEdgeList);
+
+
+// Supporting function implementation
+
+// Dump trimmed graph
+bool dumpTrimmedGraph(const char *path, const uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) &sipHashKeys, const uint8_t jobHeader[HEADER_SIZE], const uint64_t jobNonce, const int numberOfTrimmingRounds, const CompactEdgeList &compactEdgeList, const bool includeNodes) {
+
+	// Check if creating file failed
+	ofstream file(path, ofstream::binary | ofstream::trunc);
+	if(!file) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Create header
+	TrimmedGraphHeader header = {};
+	memcpy(header.magic, TRIMMED_GRAPH_MAGIC, sizeof(header.magic));
+	header.version = TRIMMED_GRAPH_VERSION;
+	header.edgeBits = EDGE_BITS;
+	header.jobNonce = jobNonce;
+	header.numberOfEdges = compactEdgeList.getNumberOfEdges();
+	header.numberOfTrimmingRounds = numberOfTrimmingRounds;
+	header.hasNodes = includeNodes;
+	memcpy(header.jobHeader, jobHeader, sizeof(header.jobHeader));
+	
+	// Go through all SipHash keys
+	for(int i = 0; i < SIPHASH_KEYS_SIZE; ++i) {
+	
+		// Set SipHash key in the header
+		header.sipHashKeys[i] = sipHashKeys[i];
+	}
+	
+	// Check if writing header to file failed
+	if(!file.write(reinterpret_cast<const char *>(&header), sizeof(header))) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if including nodes
+	const CompactEdge *edges = compactEdgeList.getEdges();
+	if(includeNodes) {
+	
+		// Check if writing edges and their nodes to file failed
+		if(!file.write(reinterpret_cast<const char *>(edges), sizeof(edges[0]) * compactEdgeList.getNumberOfEdges())) {
+		
+			// Return false
+			return false;
+		}
+	}
+	
+	// Otherwise
+	else {
+	
+		// Go through all edges
+		for(size_t i = 0; i < compactEdgeList.getNumberOfEdges(); ++i) {
+		
+			// Check if writing edge's index to file failed
+			if(!file.write(reinterpret_cast<const char *>(&edges[i].edgeIndex), sizeof(edges[i].edgeIndex))) {
+			
+				// Return false
+				return false;
+			}
+		}
+	}
+	
+	// Return if flushing file was successful
+	return static_cast<bool>(file.flush());
+}
+
+// Load trimmed graph
+bool loadTrimmedGraph(const char *path, TrimmedGraphHeader &header, CompactEdgeList &compactEdgeList) {
+
+	// Check if opening file or reading its header failed
+	ifstream file(path, ifstream::binary);
+	if(!file || !file.read(reinterpret_cast<char *>(&header), sizeof(header))) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if header is invalid
+	if(memcmp(header.magic, TRIMMED_GRAPH_MAGIC, sizeof(header.magic)) || header.version != TRIMMED_GRAPH_VERSION || header.edgeBits != EDGE_BITS || header.numberOfEdges > NUMBER_OF_EDGES) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Check if creating compact edge list failed
+	if(!compactEdgeList.reserve(header.numberOfEdges)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Clear compact edge list
+	compactEdgeList.clear();
+	
+	// Check if file has nodes
+	if(header.hasNodes) {
+	
+		// Go through all edges
+		for(uint64_t i = 0; i < header.numberOfEdges; ++i) {
+		
+			// Check if reading edge and its nodes from file failed or they're invalid
+			CompactEdge edge;
+			if(!file.read(reinterpret_cast<char *>(&edge), sizeof(edge)) || edge.edgeIndex >= NUMBER_OF_EDGES || edge.nodes[0] > NODE_MASK || edge.nodes[1] > NODE_MASK) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Add edge and its nodes to the compact edge list
+			compactEdgeList.add(edge.edgeIndex, edge.nodes[0], edge.nodes[1]);
+		}
+	}
+	
+	// Otherwise
+	else {
+	
+		// Get SipHash keys from header
+		uint64_t __attribute__((vector_size(sizeof(uint64_t) * SIPHASH_KEYS_SIZE))) sipHashKeys;
+		for(int i = 0; i < SIPHASH_KEYS_SIZE; ++i) {
+		
+			// Set SipHash key from the header
+			sipHashKeys[i] = header.sipHashKeys[i];
+		}
+		
+		// Go through all edges
+		uint32_t nonces[EDGES_BATCH_SIZE];
+		size_t numberOfNonces = 0;
+		for(uint64_t i = 0;; ++i) {
+		
+			// Check if at the end of the edges or the nonces are full
+			if(i == header.numberOfEdges || numberOfNonces == EDGES_BATCH_SIZE) {
+			
+				// Get nodes from the nonces
+				uint32_t nodes[EDGES_BATCH_SIZE];
+				sipHash24Batch(sipHashKeys, nonces, nodes, numberOfNonces);
+				
+				// Go through all pairs of nodes
+				for(size_t j = 0; j < numberOfNonces; j += 2) {
+				
+					// Add edge and its nodes to the compact edge list
+					compactEdgeList.add(nonces[j] / 2, nodes[j] & NODE_MASK, nodes[j + 1] & NODE_MASK);
+				}
+				
+				// Check if at the end of the edges
+				numberOfNonces = 0;
+				if(i == header.numberOfEdges) {
+				
+					// Break
+					break;
+				}
+			}
+			
+			// Check if reading edge's index from file failed or it's invalid
+			uint32_t edgeIndex;
+			if(!file.read(reinterpret_cast<char *>(&edgeIndex), sizeof(edgeIndex)) || edgeIndex >= NUMBER_OF_EDGES) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Add edge's nonces on both partitions to the nonces
+			nonces[numberOfNonces++] = edgeIndex * 2;
+			nonces[numberOfNonces++] = (edgeIndex * 2) | 1;
+		}
+	}
+	
+	// Return true
+	return true;
+}
+
+
+#endif